@@ -7,6 +7,7 @@
 // 헤더 파일 포함
 #include <iostream>
 #include <cmath>
+#include <cstdlib>
 #include <fstream>
 #include <thread>
 #ifdef __APPLE__
@@ -32,6 +33,9 @@
 #include "SocketServer.h"
 #include "YamlConverter.h"
 #include "Draw.h"
+#include "SceneFile.h"
+#include "Profiler.h"
+#include "Trace.h"
 
 // 전역 변수 선언
 AttributesManager attributesManager;
@@ -84,20 +88,22 @@ void LinerSegmentTest(AttributesManager& _attributesManager) {
 
     // AttributesManager에서 NodeVector와 해당 인덱스에 맞는 BearingVector 가져오기
     const auto& storedNodes = _attributesManager.getNodeVectors();
-    const auto& storedBearings = _attributesManager.getBearingVectors();
 
     if (storedNodes.size() >= 2) {
         node1.node = storedNodes[0];
         node2.node = storedNodes[1];
 
-        // Node 1과 Node 2에 해당하는 BearingVectors 추가
-        for (const auto& bearing : storedBearings) {
-            if (bearing.getNodeIndex() == node1.node.GetSphericalNodeVector().i_n) {
-                node1.bearings.push_back(bearing);
-                std::cout << "Bearing vector added to Node 1, Node Index: " << node1.node.GetSphericalNodeVector().i_n << std::endl;
-            } else if (bearing.getNodeIndex() == node2.node.GetSphericalNodeVector().i_n) {
-                node2.bearings.push_back(bearing);
-                std::cout << "Bearing vector added to Node 2, Node Index: " << node2.node.GetSphericalNodeVector().i_n << std::endl;
+        // Node 1과 Node 2에 해당하는 BearingVectors 추가 (node별 인접 목록, depth 순서)
+        int node1Index = node1.node.GetSphericalNodeVector().i_n;
+        int node2Index = node2.node.GetSphericalNodeVector().i_n;
+        for (BearingHandle handle : _attributesManager.GetNodeBearings(node1Index)) {
+            node1.bearings.push_back(*_attributesManager.GetBearingVector(handle));
+            std::cout << "Bearing vector added to Node 1, Node Index: " << node1Index << std::endl;
+        }
+        if (node2Index != node1Index) {
+            for (BearingHandle handle : _attributesManager.GetNodeBearings(node2Index)) {
+                node2.bearings.push_back(*_attributesManager.GetBearingVector(handle));
+                std::cout << "Bearing vector added to Node 2, Node Index: " << node2Index << std::endl;
             }
         }
 
@@ -136,6 +142,9 @@ void AttributesManagerTest(AttributesManager& _attributesManager) {
 
     // LinerSegmentTest 함수를 호출하여 LinerSegment 생성 및 저장
     LinerSegmentTest(_attributesManager);
+
+    // 추가한 segment를 샘플링하고 snapshot으로 publish (YAML 변환/socket thread는 snapshot을 읽음)
+    _attributesManager.FlushDirtySegments();
 }
 
 // 수정된 YamlConverterTest 함수
@@ -171,6 +180,7 @@ void YamlConverterTest(AttributesManager& _attributesManager) {
 
 // Display 콜백 함수
 void DisplayCallback() {
+    PROFILE_SCOPE("DisplayCallback");
     // OpenGL 그리기 설정
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); // 화면과 깊이 버퍼 지우기
 
@@ -195,7 +205,9 @@ void DisplayCallback() {
               0.0, 0.0, 0.0,   // 바라보는 지점
               -1.0, 1.0, 1.0);   // 상단을 위로 설정
 
-    std::cout << "DisplayCallback called." << std::endl; // 디버깅용 로그 추가
+    // 편집으로 dirty가 된 segment만 다시 샘플링
+    std::size_t resampled = attributesManager.FlushDirtySegments();
+    TRACE_DEBUG("DisplayCallback: %zu segments resampled", resampled);
     // `Draw` 객체가 전역으로 선언되어 있어야 함
     if (draw) {
         draw->DrawNodeVector();
@@ -203,7 +215,7 @@ void DisplayCallback() {
         draw->DrawForce();
         draw->DrawSamplePoint();
     } else {
-        std::cerr << "Draw object is not initialized." << std::endl;
+        TRACE_ERROR("Draw object is not initialized.");
     }
 
     // 그린 내용을 화면에 출력
@@ -226,9 +238,36 @@ int main(int argc, char** argv) {
     // 전역 AttributesManager 사용
     // AttributesManager attributesManager; // 제거
 
-    // 테스트 함수 호출 (데이터 추가)
-    AttributesManagerTest(attributesManager);
+    // PROFILE_OUTPUT이 설정되어 있으면 단계별 구간을 기록하고 종료 시 Chrome trace JSON으로 저장
+    Profiler::SetThreadName("main");
+    if (std::getenv("PROFILE_OUTPUT")) {
+        Profiler::Start();
+        std::atexit([] {
+            const char* path = std::getenv("PROFILE_OUTPUT");
+            if (!Profiler::WriteChromeTrace(path)) {
+                TRACE_ERROR("Failed to write profile to %s", path);
+            }
+        });
+    }
+
+    // 인자로 scene 파일(binary 또는 YAML/JSON)이 주어지면 불러오고, 없으면 테스트 데이터 추가
+    MappedScene scene;
+    std::string input = argc > 1 && argv[1][0] != '-' ? argv[1] : "";
+    std::string extension = input.substr(input.find_last_of('.') + 1);
+    if (!input.empty() && (extension == "yaml" || extension == "yml" || extension == "json")) {
+        if (YamlConverter().FromYaml(input, attributesManager)) {
+            TRACE_INFO("Loaded %zu segments from %s", attributesManager.getLinerSegments().size(), input.c_str());
+        }
+    } else if (!input.empty() && scene.Open(input)) {
+        std::size_t segments = scene.ImportInto(attributesManager);
+        TRACE_INFO("Loaded %zu segments from %s", segments, input.c_str());
+        scene.Close();
+    } else {
+        AttributesManagerTest(attributesManager);
+    }
     YamlConverterTest(attributesManager);
+    // 다음 실행에서 인자로 넘겨 다시 불러올 수 있도록 binary scene으로도 저장
+    SceneFile::Write(attributesManager, "../log/attributes.scene");
 
     // 서버를 실행하여 클라이언트 요청에 응답 (별도의 스레드)
     std::thread serverThread(SocketServerTest, std::ref(attributesManager));
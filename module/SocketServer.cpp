@@ -5,14 +5,68 @@
  * 
  * Purpose of Class
  * 
+ * Commands (한 번의 read에 명령 하나, 끝의 줄바꿈은 무시)
+ * - call_attributes_manager [profile] : 마지막으로 publish된 snapshot을 YAML로 전송
+ * - set_export_profile <profile>      : 이 연결의 기본 export profile 설정
+ *   profile은 full, topology-only, render-points 또는 field 이름 목록 (YamlEmitter::ParseFields 참고)
  */
 
 #include "SocketServer.h"
 #include "YamlConverter.h"
-#include <iostream>
+#include "Profiler.h"
+#include "Trace.h"
 #include <unistd.h>
+#include <cerrno>
 #include <cstring>
 #include <thread>
+#include <sys/socket.h>
+
+namespace {
+
+// size byte를 모두 보낼 때까지 send 반복 (send는 일부만 보낼 수 있음)
+bool SendAll(int clientSocket, const char* data, std::size_t size) {
+    PROFILE_SCOPE("SocketServer::send");
+#ifdef MSG_NOSIGNAL
+    const int flags = MSG_NOSIGNAL; // 끊긴 client에 보내도 SIGPIPE로 종료되지 않음
+#else
+    const int flags = 0;
+#endif
+    while (size > 0) {
+        ssize_t sent = send(clientSocket, data, size, flags);
+        if (sent < 0 && errno == EINTR) continue;
+        if (sent <= 0) {
+            TRACE_WARN("send failed (socket %d): %s", clientSocket, std::strerror(errno));
+            return false;
+        }
+        data += sent;
+        size -= static_cast<std::size_t>(sent);
+    }
+    return true;
+}
+
+// YamlConverter::Write의 조각을 바로 socket으로 보냄 (조각 크기는 YamlConverter::kStreamChunkSize 이하)
+class SocketYamlSink : public YamlSink {
+public:
+    explicit SocketYamlSink(int socket) : clientSocket(socket) {}
+
+    bool Write(const char* data, std::size_t size) override { return SendAll(clientSocket, data, size); }
+
+private:
+    int clientSocket;
+};
+
+// 수신한 byte를 명령과 인자로 나눔 ("call_attributes_manager render-points\n" 등)
+// read는 NUL로 끝나지 않으므로 bytesRead만큼만 사용하고, 끝의 줄바꿈/NUL/공백은 제거
+void ParseCommand(const char* data, std::size_t size, std::string& command, std::string& argument) {
+    std::string text(data, size);
+    std::size_t end = text.find_last_not_of(std::string(" \t\r\n\0", 5));
+    text.erase(end == std::string::npos ? 0 : end + 1);
+    std::size_t separator = text.find(' ');
+    command = text.substr(0, separator);
+    argument = separator == std::string::npos ? std::string() : text.substr(separator + 1);
+}
+
+} // namespace
 
 SocketServer::SocketServer(int serverPort, AttributesManager& attrManager)
     : serverPort(serverPort), serverSocketFd(-1), attributesManager_(attrManager) {
@@ -29,21 +83,21 @@ SocketServer::~SocketServer() {
 bool SocketServer::startServer() {
     serverSocketFd = socket(AF_INET, SOCK_STREAM, 0);
     if (serverSocketFd < 0) {
-        std::cerr << "Failed to create socket." << std::endl;
+        TRACE_ERROR("Failed to create socket.");
         return false;
     }
 
     if (bind(serverSocketFd, (struct sockaddr*)&serverAddr, sizeof(serverAddr)) < 0) {
-        std::cerr << "Bind failed." << std::endl;
+        TRACE_ERROR("Bind failed (port %d).", serverPort);
         return false;
     }
 
     if (listen(serverSocketFd, 3) < 0) {
-        std::cerr << "Listen failed." << std::endl;
+        TRACE_ERROR("Listen failed (port %d).", serverPort);
         return false;
     }
 
-    std::cout << "Server started and listening on port " << serverPort << std::endl;
+    TRACE_INFO("Server started and listening on port %d", serverPort);
     return true;
 }
 
@@ -53,26 +107,48 @@ void SocketServer::listenForClients() {
     while (true) {
         int clientSocket = accept(serverSocketFd, (struct sockaddr*)&clientAddr, &clientAddrLen);
         if (clientSocket < 0) {
-            std::cerr << "Failed to accept client connection." << std::endl;
+            TRACE_WARN("Failed to accept client connection.");
             continue;
         }
-        std::cout << "Client connected." << std::endl;
+        TRACE_INFO("Client connected (socket %d).", clientSocket);
 
         std::thread([this, clientSocket]() {
-            char buffer[1024] = {0};
+            Profiler::SetThreadName("socket client");
+            char buffer[1024];
+            // 이 연결의 export profile (set_export_profile로 변경, 기본값은 full)
+            // 공유 ThreadPool은 호출을 직렬화하므로 병렬 format을 끄고 이 연결의 thread에서만 만든다
+            // (render thread의 FlushDirtySegments가 export를 기다리지 않도록)
+            YamlEmitOptions exportOptions;
+            exportOptions.parallel = false;
             while (true) {
-                int bytesRead = read(clientSocket, buffer, 1024);
+                ssize_t bytesRead = read(clientSocket, buffer, sizeof(buffer));
                 if (bytesRead <= 0) {
-                    std::cerr << "Client disconnected or error occurred." << std::endl;
+                    TRACE_INFO("Client disconnected or error occurred (socket %d).", clientSocket);
                     close(clientSocket);
                     break;
                 }
-                std::cout << "Received: " << buffer << std::endl;
+                TRACE_DEBUG("Received %d bytes: %.*s", static_cast<int>(bytesRead), static_cast<int>(bytesRead), buffer);
 
-                if (std::string(buffer) == "call_attributes_manager") {
-                    // 기존 AttributesManager를 사용
-                    std::string response = YamlConverter().ToString(attributesManager_);
-                    sendResponse(clientSocket, response);
+                std::string command, argument;
+                ParseCommand(buffer, static_cast<std::size_t>(bytesRead), command, argument);
+                if (command == "call_attributes_manager") {
+                    // 인자가 있으면 이번 요청에만 그 profile 사용
+                    YamlEmitOptions options = exportOptions;
+                    if (!argument.empty() && !YamlEmitter::ParseFields(argument, options.fields)) {
+                        sendResponse(clientSocket, "Unknown export profile: " + argument);
+                        continue;
+                    }
+                    // 마지막으로 publish된 snapshot을 사용 (render thread의 수정과 경쟁하지 않음)
+                    // 문서 전체를 만들지 않고 조각 단위로 바로 전송
+                    std::shared_ptr<const AttributesSnapshot> snapshot = attributesManager_.Snapshot();
+                    SocketYamlSink sink(clientSocket);
+                    YamlConverter().Write(*snapshot, sink, options);
+                } else if (command == "set_export_profile") {
+                    if (YamlEmitter::ParseFields(argument, exportOptions.fields)) {
+                        sendResponse(clientSocket, "Export profile set: " + argument);
+                    } else {
+                        sendResponse(clientSocket, "Unknown export profile: " + argument);
+                    }
                 } else {
                     sendResponse(clientSocket, "Unknown command received.");
                 }
@@ -82,13 +158,13 @@ void SocketServer::listenForClients() {
 }
 
 void SocketServer::sendResponse(int clientSocket, const std::string& message) {
-    send(clientSocket, message.c_str(), message.size(), 0);
+    SendAll(clientSocket, message.c_str(), message.size());
 }
 
 void SocketServer::closeServer() {
     if (serverSocketFd >= 0) {
         close(serverSocketFd);
         serverSocketFd = -1;
-        std::cout << "Server closed." << std::endl;
+        TRACE_INFO("Server closed.");
     }
 }
@@ -3,14 +3,57 @@
  * Security: Top Secret
  * Author: Minseok Doo
  * Date: Oct 13, 2024
- * 
+ *
  * Purpose: Implement the AttributesManager class
  */
 
 #include "AttributesManager.h"
+#include "Profiler.h"
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace {
+// segment 재샘플링 비용 추정: (degree + 1) × (LOD + 1)
+double EstimateSamplingCost(const LinerSegment& segment) {
+    double degree = static_cast<double>(segment.getControlPoints().size());
+    double lod = static_cast<double>(segment.getLevelOfDetail()) + 1.0;
+    return degree * (lod > 1.0 ? lod : 1.0);
+}
+
+// 목록에서 handle 하나를 순서를 유지하며 제거
+template <typename HandleT>
+void RemoveHandle(std::vector<HandleT>& handles, HandleT handle) {
+    auto it = std::find(handles.begin(), handles.end(), handle);
+    if (it != handles.end()) handles.erase(it);
+}
+
+// count개 원소의 chunk 목록 구성: 바뀌지 않은 chunk는 이전 snapshot과 공유하고 나머지만 build로 생성
+template <typename Chunk, typename BuildChunk>
+void RebuildChunks(const SnapshotChunks<Chunk>& previous, std::vector<unsigned char>& dirtyChunks,
+                   std::size_t count, SnapshotChunks<Chunk>& chunks, BuildChunk build) {
+    std::size_t chunkCount = (count + kSnapshotChunkSize - 1) / kSnapshotChunkSize;
+    chunks.resize(chunkCount);
+    for (std::size_t c = 0; c < chunkCount; ++c) {
+        bool dirty = c >= dirtyChunks.size() || dirtyChunks[c];
+        if (!dirty && c < previous.size()) {
+            chunks[c] = previous[c];
+            continue;
+        }
+        std::size_t first = c * kSnapshotChunkSize;
+        auto chunk = std::make_shared<Chunk>();
+        build(*chunk, first, std::min(kSnapshotChunkSize, count - first));
+        chunks[c] = std::move(chunk);
+    }
+    dirtyChunks.assign(chunkCount, 0);
+}
+}
 
 // 생성자
-AttributesManager::AttributesManager() {
+AttributesManager::AttributesManager()
+    : hasDuplicateNodeIndices(false),
+      publishedSnapshot(std::make_shared<const AttributesSnapshot>()),
+      snapshotPending(false),
+      transactionDepth(0) {
     // 초기화 코드 (필요 시)
 }
 
@@ -19,95 +62,634 @@ AttributesManager::~AttributesManager() {
     // 정리 코드 (필요 시)
 }
 
+// Transaction 관련 함수 구현
+
+// 대량 수정 시작 (용량 확보)
+void AttributesManager::BeginTransaction(std::size_t extraNodes, std::size_t extraBearings, std::size_t extraSegments) {
+    ++transactionDepth;
+    if (extraNodes > 0) {
+        nodeVectors.reserve(nodeVectors.size() + extraNodes);
+        nodeSlots.reserve(nodeSlots.size() + extraNodes);
+        nodeByIndex.reserve(nodeByIndex.size() + extraNodes);
+    }
+    if (extraBearings > 0) {
+        bearingVectors.reserve(bearingVectors.size() + extraBearings);
+        bearingSlots.reserve(bearingSlots.size() + extraBearings);
+        pendingBearingNodes.reserve(pendingBearingNodes.size() + extraBearings);
+    }
+    if (extraSegments > 0) {
+        linerSegments.reserve(linerSegments.size() + extraSegments);
+        segmentSlots.reserve(segmentSlots.size() + extraSegments);
+    }
+}
+
+// 미뤄 둔 갱신을 한 번에 반영
+void AttributesManager::CommitTransaction() {
+    if (transactionDepth == 0 || --transactionDepth > 0) return;
+
+    // 인접 목록: bearing이 추가/수정된 node만 한 번씩 정렬
+    std::sort(pendingBearingNodes.begin(), pendingBearingNodes.end());
+    pendingBearingNodes.erase(std::unique(pendingBearingNodes.begin(), pendingBearingNodes.end()),
+                              pendingBearingNodes.end());
+    for (int nodeIndex : pendingBearingNodes) {
+        SortBearingAdjacency(nodeIndex);
+    }
+    pendingBearingNodes.clear();
+
+    // 샘플과 함께 추가된 segment 중 추가 이후 양 끝 node가 바뀌지 않은 것 (아래 dirty 표시 후 되돌림)
+    std::vector<SegmentHandle> keepSampled;
+    for (const PendingSampledSegment& entry : pendingSampledSegments) {
+        std::size_t pos = segmentSlots.Find(entry.handle);
+        if (pos == SlotIndex<SegmentHandleTag>::npos) continue;
+        const LinerSegment& segment = linerSegments[pos];
+        auto first = pendingDirtyNodes.begin() + static_cast<std::ptrdiff_t>(entry.pendingMark);
+        if (std::find(first, pendingDirtyNodes.end(), segment.getStartNodeIndex()) == pendingDirtyNodes.end() &&
+            std::find(first, pendingDirtyNodes.end(), segment.getEndNodeIndex()) == pendingDirtyNodes.end()) {
+            keepSampled.push_back(entry.handle);
+        }
+    }
+    pendingSampledSegments.clear();
+
+    // 의존 segment: 바뀐 node마다 한 번씩 dirty 표시
+    std::sort(pendingDirtyNodes.begin(), pendingDirtyNodes.end());
+    pendingDirtyNodes.erase(std::unique(pendingDirtyNodes.begin(), pendingDirtyNodes.end()),
+                            pendingDirtyNodes.end());
+    for (int nodeIndex : pendingDirtyNodes) {
+        MarkDependentsDirty(nodeIndex);
+    }
+    pendingDirtyNodes.clear();
+    for (SegmentHandle handle : keepSampled) {
+        linerSegments[segmentSlots.Find(handle)].clearDirty(); // dirtySegments에 남은 handle은 flush에서 건너뜀
+    }
+
+    // transaction 중 추가/수정된 Lazy node를 한 번에 batch 변환한 뒤 재샘플링 후 한 번 publish
+    nodeVectors.convertPending();
+    FlushDirtySegments();
+}
+
 // NodeVector 관련 함수 구현
 
+// 사용자 index -> handle 등록 (이미 있으면 먼저 추가된 node 유지)
+void AttributesManager::MapNodeIndex(int nodeIndex, NodeHandle handle) {
+    if (!nodeByIndex.emplace(nodeIndex, handle).second) {
+        hasDuplicateNodeIndices = true;
+    }
+}
+
+// 사용자 index -> handle 해제 (같은 index의 다른 node가 있으면 그 node로 교체)
+void AttributesManager::UnmapNodeIndex(int nodeIndex, NodeHandle handle) {
+    auto it = nodeByIndex.find(nodeIndex);
+    if (it == nodeByIndex.end() || it->second != handle) return;
+    nodeByIndex.erase(it);
+    if (!hasDuplicateNodeIndices) return;
+
+    NodeCartesianView nodes = nodeVectors.cartesian();
+    for (std::size_t pos = 0; pos < nodes.size; ++pos) {
+        NodeHandle other = nodeSlots.HandleAt(pos);
+        if (nodes.index[pos] == nodeIndex && other != handle) {
+            nodeByIndex.emplace(nodeIndex, other);
+            return;
+        }
+    }
+}
+
+// 사용자 index의 NodeStore 위치 (없으면 npos)
+std::size_t AttributesManager::NodePositionOf(int nodeIndex) const {
+    auto it = nodeByIndex.find(nodeIndex);
+    if (it == nodeByIndex.end()) return NodeStore::npos;
+    return nodeSlots.Find(it->second);
+}
+
 // NodeVector 생성
-NodeVector AttributesManager::CreateNodeVector(const NodeVector& node) {
+NodeHandle AttributesManager::CreateNodeVector(const NodeVector& node) {
     nodeVectors.push_back(node);
-    return nodeVectors.back();
+    if (transactionDepth == 0) nodeVectors.convertPending(); // transaction 중에는 commit에서 한 번에 변환
+    MarkChunk(dirtyNodeChunks, nodeVectors.size() - 1);
+    NodeHandle handle = nodeSlots.Insert();
+    int nodeIndex = nodeVectors.indexData()[nodeVectors.size() - 1]; // Lazy node를 변환하지 않도록 저장된 index 사용
+    MapNodeIndex(nodeIndex, handle);
+    // 이 index를 참조하던 segment가 있으면 (node가 삭제 후 다시 추가된 경우) 다시 샘플링
+    MarkDependentsDirty(nodeIndex);
+    return handle;
+}
+
+// 여러 NodeVector 생성 (하나의 transaction)
+// node 하나의 좌표 변환은 probe 비용보다 짧으므로 batch 단위로만 측정
+std::vector<NodeHandle> AttributesManager::CreateNodeVectors(const std::vector<NodeVector>& nodes) {
+    PROFILE_SCOPE("AttributesManager::CreateNodeVectors");
+    std::vector<NodeHandle> handles;
+    handles.reserve(nodes.size());
+    BeginTransaction(nodes.size(), 0, 0);
+    for (const auto& node : nodes) {
+        handles.push_back(CreateNodeVector(node));
+    }
+    CommitTransaction();
+    return handles;
 }
 
 // NodeVector 수정
 bool AttributesManager::EditNodeVector(int index, const NodeVector& newNode) {
-    for(auto &node : nodeVectors) {
-        if(node.GetSphericalNodeVector().i_n == index) {
-            node = newNode;
-            return true;
-        }
+    return EditNodeVector(FindNodeVector(index), newNode);
+}
+
+bool AttributesManager::EditNodeVector(NodeHandle handle, const NodeVector& newNode) {
+    std::size_t pos = nodeSlots.Find(handle);
+    if (pos == SlotIndex<NodeHandleTag>::npos) {
+        return false; // 해당 node를 찾지 못함
+    }
+    int oldIndex = nodeVectors.indexData()[pos];
+    nodeVectors.set(pos, newNode);
+    if (transactionDepth == 0) nodeVectors.convertPending();
+    MarkChunk(dirtyNodeChunks, pos);
+
+    // 이 node를 사용하는 segment만 dirty로 표시 (node 데이터는 NodeStore 한 곳에만 있음)
+    MarkDependentsDirty(oldIndex);
+    int newIndex = nodeVectors.indexData()[pos];
+    if (newIndex != oldIndex) {
+        UnmapNodeIndex(oldIndex, handle);
+        MapNodeIndex(newIndex, handle);
+        MarkDependentsDirty(newIndex);
     }
-    return false; // 해당 인덱스를 찾지 못함
+    return true;
 }
 
 // NodeVector 삭제
 bool AttributesManager::DeleteNodeVector(int index) {
-    for(auto it = nodeVectors.begin(); it != nodeVectors.end(); ++it) {
-        if(it->GetSphericalNodeVector().i_n == index) {
-            nodeVectors.erase(it);
-            return true;
-        }
+    return DeleteNodeVector(FindNodeVector(index));
+}
+
+bool AttributesManager::DeleteNodeVector(NodeHandle handle) {
+    std::size_t pos = nodeSlots.Find(handle);
+    if (pos == SlotIndex<NodeHandleTag>::npos) {
+        return false; // 해당 node를 찾지 못함
     }
-    return false; // 해당 인덱스를 찾지 못함
+    int nodeIndex = nodeVectors.indexData()[pos];
+    nodeSlots.Erase(handle);
+    MarkChunk(dirtyNodeChunks, pos);
+    MarkChunk(dirtyNodeChunks, nodeVectors.size() - 1);
+    nodeVectors.swapErase(pos);
+    UnmapNodeIndex(nodeIndex, handle);
+    MarkDependentsDirty(nodeIndex);
+    return true;
+}
+
+// 사용자 index로 handle 검색
+NodeHandle AttributesManager::FindNodeVector(int index) const {
+    auto it = nodeByIndex.find(index);
+    return it == nodeByIndex.end() ? NodeHandle() : it->second;
+}
+
+// handle로 NodeVector 조회
+bool AttributesManager::GetNodeVector(NodeHandle handle, NodeVector& node) const {
+    std::size_t pos = nodeSlots.Find(handle);
+    if (pos == SlotIndex<NodeHandleTag>::npos) return false;
+    node = nodeVectors[pos];
+    return true;
 }
 
 // BearingVector 관련 함수 구현
 
 // BearingVector 생성
-BearingVector AttributesManager::CreateBearingVector(const BearingVector& bearing) {
+BearingHandle AttributesManager::CreateBearingVector(const BearingVector& bearing) {
     bearingVectors.push_back(bearing);
-    return bearingVectors.back();
+    MarkChunk(dirtyBearingChunks, bearingVectors.size() - 1);
+    BearingHandle handle = bearingSlots.Insert();
+    InsertBearingAdjacency(bearing.getNodeIndex(), handle);
+    MarkDependentsDirty(bearing.getNodeIndex());
+    return handle;
+}
+
+// 여러 BearingVector 생성 (하나의 transaction)
+std::vector<BearingHandle> AttributesManager::CreateBearingVectors(const std::vector<BearingVector>& bearings) {
+    PROFILE_SCOPE("AttributesManager::CreateBearingVectors");
+    std::vector<BearingHandle> handles;
+    handles.reserve(bearings.size());
+    BeginTransaction(0, bearings.size(), 0);
+    for (const auto& bearing : bearings) {
+        handles.push_back(CreateBearingVector(bearing));
+    }
+    CommitTransaction();
+    return handles;
 }
 
 // BearingVector 수정
 bool AttributesManager::EditBearingVector(int index, const BearingVector& newBearing) {
-    for(auto &bearing : bearingVectors) {
-        if(bearing.getNodeIndex() == index) { // 또는 다른 고유 식별자를 사용
-            bearing = newBearing;
-            return true;
-        }
+    auto it = bearingsByNode.find(index);
+    if (it == bearingsByNode.end() || it->second.empty()) {
+        return false; // 해당 인덱스를 찾지 못함
+    }
+    return EditBearingVector(LowestDepthBearing(it->second), newBearing);
+}
+
+bool AttributesManager::EditBearingVector(BearingHandle handle, const BearingVector& newBearing) {
+    std::size_t pos = bearingSlots.Find(handle);
+    if (pos == SlotIndex<BearingHandleTag>::npos) {
+        return false;
+    }
+    int oldIndex = bearingVectors[pos].getNodeIndex();
+    int oldDepth = bearingVectors[pos].getDepth();
+    int newIndex = newBearing.getNodeIndex();
+    bearingVectors[pos] = newBearing;
+    MarkChunk(dirtyBearingChunks, pos);
+
+    // node 또는 depth가 바뀌면 인접 목록에서 위치 갱신
+    if (newIndex != oldIndex || newBearing.getDepth() != oldDepth) {
+        RemoveHandle(bearingsByNode[oldIndex], handle);
+        InsertBearingAdjacency(newIndex, handle);
+    }
+
+    // 이 bearing의 node를 사용하는 segment만 dirty로 표시
+    MarkDependentsDirty(oldIndex);
+    if (newIndex != oldIndex) {
+        MarkDependentsDirty(newIndex);
     }
-    return false; // 해당 인덱스를 찾지 못함
+    return true;
 }
 
 // BearingVector 삭제
 bool AttributesManager::DeleteBearingVector(int index) {
-    for(auto it = bearingVectors.begin(); it != bearingVectors.end(); ++it) {
-        if(it->getNodeIndex() == index) { // 또는 다른 고유 식별자를 사용
-            bearingVectors.erase(it);
-            return true;
+    auto it = bearingsByNode.find(index);
+    if (it == bearingsByNode.end() || it->second.empty()) {
+        return false; // 해당 인덱스를 찾지 못함
+    }
+    return DeleteBearingVector(LowestDepthBearing(it->second));
+}
+
+bool AttributesManager::DeleteBearingVector(BearingHandle handle) {
+    std::size_t pos = bearingSlots.Find(handle);
+    if (pos == SlotIndex<BearingHandleTag>::npos) {
+        return false;
+    }
+    int nodeIndex = bearingVectors[pos].getNodeIndex();
+    bearingSlots.Erase(handle);
+    MarkChunk(dirtyBearingChunks, pos);
+    MarkChunk(dirtyBearingChunks, bearingVectors.size() - 1);
+    if (pos != bearingVectors.size() - 1) {
+        bearingVectors[pos] = std::move(bearingVectors.back());
+    }
+    bearingVectors.pop_back();
+    RemoveHandle(bearingsByNode[nodeIndex], handle);
+    MarkDependentsDirty(nodeIndex);
+    return true;
+}
+
+// 인접 목록에 depth 순서를 유지하며 추가 (같은 depth는 뒤에)
+void AttributesManager::InsertBearingAdjacency(int nodeIndex, BearingHandle handle) {
+    std::vector<BearingHandle>& adjacency = bearingsByNode[nodeIndex];
+    if (transactionDepth > 0) {
+        // commit에서 node별로 한 번만 정렬
+        adjacency.push_back(handle);
+        pendingBearingNodes.push_back(nodeIndex);
+        return;
+    }
+    int depth = bearingVectors[bearingSlots.Find(handle)].getDepth();
+    auto it = std::upper_bound(adjacency.begin(), adjacency.end(), depth,
+                               [this](int d, BearingHandle other) {
+                                   return d < bearingVectors[bearingSlots.Find(other)].getDepth();
+                               });
+    adjacency.insert(it, handle);
+}
+
+// node의 인접 목록을 depth 순서로 정렬 (같은 depth는 기존 순서 유지)
+void AttributesManager::SortBearingAdjacency(int nodeIndex) {
+    auto it = bearingsByNode.find(nodeIndex);
+    if (it == bearingsByNode.end()) return;
+    std::vector<BearingHandle>& adjacency = it->second;
+
+    std::vector<std::pair<int, BearingHandle>> keyed;
+    SortByDepth(adjacency, keyed);
+    for (std::size_t i = 0; i < keyed.size(); ++i) {
+        adjacency[i] = keyed[i].second;
+    }
+}
+
+// (depth, handle) 목록을 depth 순서로 안정 정렬 (같은 depth는 목록 순서 = 추가 순서 유지)
+void AttributesManager::SortByDepth(const std::vector<BearingHandle>& adjacency,
+                                    std::vector<std::pair<int, BearingHandle>>& keyed) const {
+    keyed.clear();
+    keyed.reserve(adjacency.size());
+    for (BearingHandle handle : adjacency) {
+        keyed.emplace_back(bearingVectors[bearingSlots.Find(handle)].getDepth(), handle);
+    }
+    std::stable_sort(keyed.begin(), keyed.end(),
+                     [](const std::pair<int, BearingHandle>& a, const std::pair<int, BearingHandle>& b) {
+                         return a.first < b.first;
+                     });
+}
+
+// depth가 가장 작은 bearing (정렬된 목록이면 맨 앞, transaction 중에는 선형 탐색)
+BearingHandle AttributesManager::LowestDepthBearing(const std::vector<BearingHandle>& adjacency) const {
+    BearingHandle lowest = adjacency.front();
+    if (transactionDepth == 0) return lowest;
+    int lowestDepth = bearingVectors[bearingSlots.Find(lowest)].getDepth();
+    for (BearingHandle handle : adjacency) {
+        int depth = bearingVectors[bearingSlots.Find(handle)].getDepth();
+        if (depth < lowestDepth) {
+            lowest = handle;
+            lowestDepth = depth;
+        }
+    }
+    return lowest;
+}
+
+// (node index, depth)로 handle 검색 (인접 목록에서 이진 탐색, transaction 중에는 선형 탐색)
+BearingHandle AttributesManager::FindBearingVector(int nodeIndex, int depth) const {
+    auto it = bearingsByNode.find(nodeIndex);
+    if (it == bearingsByNode.end()) return BearingHandle();
+    const std::vector<BearingHandle>& adjacency = it->second;
+    if (transactionDepth > 0) {
+        // 정렬 전 목록도 같은 depth끼리는 추가 순서이므로 처음 찾은 것이 commit 후 이진 탐색 결과와 같음
+        for (BearingHandle handle : adjacency) {
+            if (bearingVectors[bearingSlots.Find(handle)].getDepth() == depth) return handle;
         }
+        return BearingHandle();
+    }
+    auto found = std::lower_bound(adjacency.begin(), adjacency.end(), depth,
+                                  [this](BearingHandle other, int d) {
+                                      return bearingVectors[bearingSlots.Find(other)].getDepth() < d;
+                                  });
+    if (found != adjacency.end() && bearingVectors[bearingSlots.Find(*found)].getDepth() == depth) {
+        return *found;
     }
-    return false; // 해당 인덱스를 찾지 못함
+    return BearingHandle();
+}
+
+// node의 bearing handle 목록
+ConstSpan<BearingHandle> AttributesManager::GetNodeBearings(int nodeIndex) const {
+    auto it = bearingsByNode.find(nodeIndex);
+    if (it == bearingsByNode.end()) return ConstSpan<BearingHandle>();
+    return ConstSpan<BearingHandle>(it->second.data(), it->second.size());
+}
+
+// handle로 BearingVector 조회 (없으면 nullptr, 다음 수정 전까지만 유효)
+const BearingVector* AttributesManager::GetBearingVector(BearingHandle handle) const {
+    std::size_t pos = bearingSlots.Find(handle);
+    return pos == SlotIndex<BearingHandleTag>::npos ? nullptr : &bearingVectors[pos];
 }
 
 // LinerSegment 관련 함수 구현
 
+// 다른 topology에 연결된 segment와, 복사본이 manager의 node/bearing과 같은 segment는
+// 공유 topology에 연결하고 복사본을 버린 뒤 다음 flush에서 다시 샘플링
+// 양 끝 node가 manager에 없거나 bearing이 다른 segment는 복사본을 그대로 사용 (샘플 유지)
+// 점 배열은 scene arena로 옮김
+void AttributesManager::AdoptSegment(SegmentHandle handle, LinerSegment& segment, bool wasDirty) {
+    segment.setAllocator(sceneArena.allocator());
+    if (segment.getTopology() != this && (segment.isBound() || segment.MatchesTopology(*this))) {
+        segment.BindTopology(this);
+        segment.markDirty();
+    }
+    QueueIfNewlyDirty(handle, segment, wasDirty);
+}
+
 // LinerSegment 생성
-LinerSegment AttributesManager::CreateLinerSegment(const LinerSegment& segment) {
+SegmentHandle AttributesManager::CreateLinerSegment(const LinerSegment& segment) {
     linerSegments.push_back(segment);
-    return linerSegments.back();
+    MarkChunk(dirtySegmentChunks, linerSegments.size() - 1);
+    SegmentHandle handle = segmentSlots.Insert();
+    LinerSegment& adopted = linerSegments.back();
+    AdoptSegment(handle, adopted, false);
+    AddSegmentDependencies(handle, adopted);
+    return handle;
+}
+
+// 샘플링하지 않은 LinerSegment 생성 (dirty로 추가되어 flush에서 샘플링)
+SegmentHandle AttributesManager::CreateLinerSegment(int startNode, int endNode, float lod, float alphaVal) {
+    LinerSegment segment(startNode, endNode, *this, lod, alphaVal, ScenePointVector(), ScenePointVector());
+    segment.markDirty();
+    return CreateLinerSegment(segment);
+}
+
+// 이미 샘플링된 LinerSegment 생성
+SegmentHandle AttributesManager::CreateSampledLinerSegment(const LinerSegment& segment) {
+    SegmentHandle handle = CreateLinerSegment(segment);
+    if (transactionDepth > 0) {
+        pendingSampledSegments.push_back(PendingSampledSegment{handle, pendingDirtyNodes.size()});
+    }
+    return handle;
 }
 
 // LinerSegment 수정
 bool AttributesManager::EditLinerSegment(int index, const LinerSegment& newSegment) {
-    // LinerSegment 클래스에 고유 식별자가 추가되어야 합니다.
-    // 예: segment.getId() == index
-    // 현재 예제에서는 인덱스로 접근합니다.
-    if(index >= 0 && index < linerSegments.size()) {
-        linerSegments[index] = newSegment;
-        return true;
+    if(index >= 0 && static_cast<std::size_t>(index) < linerSegments.size()) {
+        return EditLinerSegment(segmentSlots.HandleAt(static_cast<std::size_t>(index)), newSegment);
     }
     return false;
 }
 
+bool AttributesManager::EditLinerSegment(SegmentHandle handle, const LinerSegment& newSegment) {
+    std::size_t pos = segmentSlots.Find(handle);
+    if (pos == SlotIndex<SegmentHandleTag>::npos) {
+        return false;
+    }
+    LinerSegment& target = linerSegments[pos];
+    bool wasDirty = target.isDirty();
+    RemoveSegmentDependencies(handle, target);
+    // 새 segment는 일반 segment로 취급 (CreateSampledLinerSegment의 샘플 유지 대상에서 제외)
+    pendingSampledSegments.erase(
+        std::remove_if(pendingSampledSegments.begin(), pendingSampledSegments.end(),
+                       [handle](const PendingSampledSegment& entry) { return entry.handle == handle; }),
+        pendingSampledSegments.end());
+    target = newSegment;
+    MarkChunk(dirtySegmentChunks, pos);
+    AdoptSegment(handle, target, wasDirty);
+    AddSegmentDependencies(handle, target);
+    return true;
+}
+
 // LinerSegment 삭제
 bool AttributesManager::DeleteLinerSegment(int index) {
-    if(index >= 0 && index < linerSegments.size()) {
-        linerSegments.erase(linerSegments.begin() + index);
-        return true;
+    if(index >= 0 && static_cast<std::size_t>(index) < linerSegments.size()) {
+        return DeleteLinerSegment(segmentSlots.HandleAt(static_cast<std::size_t>(index)));
     }
     return false;
 }
 
+bool AttributesManager::DeleteLinerSegment(SegmentHandle handle) {
+    std::size_t pos = segmentSlots.Find(handle);
+    if (pos == SlotIndex<SegmentHandleTag>::npos) {
+        return false;
+    }
+    RemoveSegmentDependencies(handle, linerSegments[pos]);
+    segmentSlots.Erase(handle);
+    MarkChunk(dirtySegmentChunks, pos);
+    MarkChunk(dirtySegmentChunks, linerSegments.size() - 1);
+    if (pos != linerSegments.size() - 1) {
+        linerSegments[pos] = std::move(linerSegments.back());
+    }
+    linerSegments.pop_back();
+    // dirty 목록의 handle은 flush 시 무효 handle로 걸러짐
+    return true;
+}
+
+// handle로 LinerSegment 조회 (없으면 nullptr, 다음 수정 전까지만 유효)
+const LinerSegment* AttributesManager::GetLinerSegment(SegmentHandle handle) const {
+    std::size_t pos = segmentSlots.Find(handle);
+    return pos == SlotIndex<SegmentHandleTag>::npos ? nullptr : &linerSegments[pos];
+}
+
+// 의존성 그래프 관련 함수 구현
+
+// segment의 양 끝 node를 그래프에 추가
+void AttributesManager::AddSegmentDependencies(SegmentHandle handle, const LinerSegment& segment) {
+    int start = segment.getStartNodeIndex();
+    int end = segment.getEndNodeIndex();
+    segmentsByNode[start].push_back(handle);
+    if (end != start) {
+        segmentsByNode[end].push_back(handle);
+    }
+}
+
+// segment의 양 끝 node에서 제거
+void AttributesManager::RemoveSegmentDependencies(SegmentHandle handle, const LinerSegment& segment) {
+    for (int nodeIndex : {segment.getStartNodeIndex(), segment.getEndNodeIndex()}) {
+        auto it = segmentsByNode.find(nodeIndex);
+        if (it == segmentsByNode.end()) continue;
+        RemoveHandle(it->second, handle);
+        if (it->second.empty()) segmentsByNode.erase(it);
+    }
+}
+
+// dirty 플래그가 새로 설정된 segment를 목록에 추가
+void AttributesManager::QueueIfNewlyDirty(SegmentHandle handle, LinerSegment& segment, bool wasDirty) {
+    if (segment.isDirty() && !wasDirty) {
+        dirtySegments.push_back(handle);
+    }
+}
+
+// nodeIndex를 사용하는 segment를 dirty로 표시
+void AttributesManager::MarkDependentsDirty(int nodeIndex) {
+    if (transactionDepth > 0) {
+        pendingDirtyNodes.push_back(nodeIndex);
+        return;
+    }
+    auto it = segmentsByNode.find(nodeIndex);
+    if (it == segmentsByNode.end()) return;
+    for (SegmentHandle handle : it->second) {
+        std::size_t pos = segmentSlots.Find(handle);
+        LinerSegment& segment = linerSegments[pos];
+        if (!segment.isDirty()) {
+            segment.markDirty();
+            dirtySegments.push_back(handle);
+            // snapshot의 양 끝 node 값도 갱신 필요
+            MarkChunk(dirtySegmentChunks, pos);
+        }
+    }
+}
+
+// 지정한 segment들을 thread pool에서 다시 샘플링
+void AttributesManager::ResampleSegments(const std::vector<std::size_t>& positions) {
+    if (positions.empty()) return;
+    // worker는 NodePosition으로 NodeStore를 읽기만 하므로 변환은 이 thread에서 먼저 끝냄
+    nodeVectors.convertPending();
+    for (std::size_t pos : positions) {
+        MarkChunk(dirtySegmentChunks, pos);
+    }
+    ThreadPool& pool = ThreadPool::Shared();
+    if (pool.size() < 2 || positions.size() < 2) {
+        for (std::size_t pos : positions) {
+            linerSegments[pos].SamplingBezierCurve();
+        }
+        return;
+    }
+
+    std::vector<double> costs(positions.size());
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        costs[i] = EstimateSamplingCost(linerSegments[positions[i]]);
+    }
+    pool.Run(ThreadPool::PartitionByCost(costs, pool.size()),
+             [this, &positions](std::size_t i) { linerSegments[positions[i]].SamplingBezierCurve(); });
+}
+
+// 모든 LinerSegment 병렬 재샘플링
+void AttributesManager::ResampleAllLinerSegments() {
+    if (transactionDepth > 0) {
+        // commit에서 한 번에 샘플링 (저장된 샘플로 추가한 segment도 포함)
+        pendingSampledSegments.clear();
+        for (std::size_t pos = 0; pos < linerSegments.size(); ++pos) {
+            LinerSegment& segment = linerSegments[pos];
+            if (!segment.isDirty()) {
+                segment.markDirty();
+                dirtySegments.push_back(segmentSlots.HandleAt(pos));
+            }
+        }
+        return;
+    }
+    std::vector<std::size_t> positions(linerSegments.size());
+    for (std::size_t pos = 0; pos < positions.size(); ++pos) {
+        positions[pos] = pos;
+    }
+    ResampleSegments(positions);
+    dirtySegments.clear();
+    PublishSnapshot();
+}
+
+// dirty segment만 재샘플링
+std::size_t AttributesManager::FlushDirtySegments() {
+    if (transactionDepth > 0) return 0;
+    PROFILE_SCOPE("AttributesManager::FlushDirtySegments");
+    std::vector<std::size_t> positions;
+    positions.reserve(dirtySegments.size());
+    for (SegmentHandle handle : dirtySegments) {
+        std::size_t pos = segmentSlots.Find(handle);
+        if (pos != SlotIndex<SegmentHandleTag>::npos && linerSegments[pos].isDirty()) {
+            positions.push_back(pos);
+        }
+    }
+    ResampleSegments(positions);
+    dirtySegments.clear();
+    PublishSnapshot();
+    return positions.size();
+}
+
+// 모든 LinerSegment의 LOD 변경 후 재샘플링
+void AttributesManager::SetLevelOfDetailForAll(float lod) {
+    for (auto& segment : linerSegments) {
+        segment.setLevelOfDetail(lod);
+    }
+    ResampleAllLinerSegments();
+}
+
+// Topology 조회 관련 함수 구현
+// manager 상태를 바꾸지 않으므로 병렬 재샘플링 중에도 안전 (ResampleSegments가 pool 실행 전에 node 변환을 끝냄)
+
+// node의 Cartesian 좌표 (transaction 중 변환 대기 node는 지역 값으로 계산)
+bool AttributesManager::NodePosition(int nodeIndex, Vector3& position) const {
+    std::size_t pos = NodePositionOf(nodeIndex);
+    if (pos == NodeStore::npos) return false;
+    if (nodeVectors.isPending(pos)) {
+        position = nodeVectors[pos].GetCartesianNodeVector().cartesianCoords;
+        return true;
+    }
+    NodeCartesianView nodes = nodeVectors.cartesian();
+    position = Vector3(nodes.x[pos], nodes.y[pos], nodes.z[pos]);
+    return true;
+}
+
+// node에 연결된 bearing의 B ⊗ F (depth 오름차순)
+void AttributesManager::BearingDirections(int nodeIndex, ScenePointVector& directions) const {
+    auto it = bearingsByNode.find(nodeIndex);
+    if (it == bearingsByNode.end()) return;
+    if (transactionDepth > 0 && it->second.size() > 1) {
+        // 정렬이 commit까지 미뤄졌을 수 있으므로 지역 복사본을 정렬
+        std::vector<std::pair<int, BearingHandle>> keyed;
+        SortByDepth(it->second, keyed);
+        for (const auto& entry : keyed) {
+            directions.push_back(bearingVectors[bearingSlots.Find(entry.second)].getWeightedDirection());
+        }
+        return;
+    }
+    for (BearingHandle handle : it->second) {
+        directions.push_back(bearingVectors[bearingSlots.Find(handle)].getWeightedDirection());
+    }
+}
+
+// node 전체 값
+NodeVector AttributesManager::Node(int nodeIndex) const {
+    std::size_t pos = NodePositionOf(nodeIndex);
+    return pos == NodeStore::npos ? NodeVector() : nodeVectors[pos];
+}
+
 // 모든 Attributes 읽기
 Attributes AttributesManager::ReadAllAttributes() const {
     Attributes attrs;
@@ -122,4 +704,76 @@ void AttributesManager::DeleteAllAttributes() {
     nodeVectors.clear();
     bearingVectors.clear();
     linerSegments.clear();
+    nodeSlots.clear();
+    bearingSlots.clear();
+    segmentSlots.clear();
+    nodeByIndex.clear();
+    hasDuplicateNodeIndices = false;
+    bearingsByNode.clear();
+    segmentsByNode.clear();
+    dirtySegments.clear();
+    pendingSampledSegments.clear();
+    // segment가 모두 소멸되었으므로 arena 블록을 한 번에 반환
+    sceneArena.release();
+    pendingBearingNodes.clear();
+    pendingDirtyNodes.clear();
+    // 다음 publish에서 모든 chunk를 다시 구성 (빈 snapshot)
+    std::fill(dirtyNodeChunks.begin(), dirtyNodeChunks.end(), 1);
+    std::fill(dirtyBearingChunks.begin(), dirtyBearingChunks.end(), 1);
+    std::fill(dirtySegmentChunks.begin(), dirtySegmentChunks.end(), 1);
+    snapshotPending = true;
+}
+
+// Snapshot 관련 함수 구현
+
+// pos가 속한 chunk를 변경됨으로 표시
+void AttributesManager::MarkChunk(std::vector<unsigned char>& dirtyChunks, std::size_t pos) {
+    std::size_t chunk = pos / kSnapshotChunkSize;
+    if (chunk >= dirtyChunks.size()) {
+        dirtyChunks.resize(chunk + 1, 0);
+    }
+    dirtyChunks[chunk] = 1;
+    snapshotPending = true;
+}
+
+// 마지막으로 publish된 snapshot
+std::shared_ptr<const AttributesSnapshot> AttributesManager::Snapshot() const {
+    return std::atomic_load(&publishedSnapshot);
+}
+
+// 바뀐 chunk만 새로 만들어 snapshot 교체
+void AttributesManager::PublishSnapshot() {
+    if (!snapshotPending || transactionDepth > 0) return;
+    nodeVectors.convertPending(); // snapshot chunk에는 변환 대기 node가 없도록
+    std::shared_ptr<const AttributesSnapshot> previous = std::atomic_load(&publishedSnapshot);
+
+    auto next = std::make_shared<AttributesSnapshot>();
+    next->version = previous->version + 1;
+    next->nodeCount = nodeVectors.size();
+    next->bearingCount = bearingVectors.size();
+    next->segmentCount = linerSegments.size();
+
+    RebuildChunks(previous->nodeChunks, dirtyNodeChunks, nodeVectors.size(), next->nodeChunks,
+                  [this](NodeStore& chunk, std::size_t first, std::size_t n) {
+                      chunk.append(nodeVectors, first, n);
+                  });
+    RebuildChunks(previous->bearingChunks, dirtyBearingChunks, bearingVectors.size(), next->bearingChunks,
+                  [this](std::vector<BearingVector>& chunk, std::size_t first, std::size_t n) {
+                      chunk.assign(bearingVectors.begin() + first, bearingVectors.begin() + first + n);
+                  });
+    RebuildChunks(previous->segmentChunks, dirtySegmentChunks, linerSegments.size(), next->segmentChunks,
+                  [this](std::vector<SegmentRecord>& chunk, std::size_t first, std::size_t n) {
+                      chunk.resize(n);
+                      for (std::size_t i = 0; i < n; ++i) {
+                          const LinerSegment& segment = linerSegments[first + i];
+                          chunk[i].data = segment.ReturnLinerSegmentData();
+                          chunk[i].controlPoints.assign(segment.getControlPoints().begin(),
+                                                        segment.getControlPoints().end());
+                          chunk[i].sampledPoints.assign(segment.getSampledPoints().begin(),
+                                                        segment.getSampledPoints().end());
+                      }
+                  });
+
+    std::atomic_store(&publishedSnapshot, std::shared_ptr<const AttributesSnapshot>(std::move(next)));
+    snapshotPending = false;
 }
@@ -11,47 +11,203 @@
 #define ATTRIBUTESMANAGER_H
 
 #include "NodeVector.h"
+#include "NodeStore.h"
 #include "BearingVector.h"
 #include "LinerSegment.h"
+#include "SlotIndex.h"
+#include "AttributesSnapshot.h"
+#include <memory>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 struct Attributes {
-    std::vector<NodeVector> nodeVectors;
+    NodeStore nodeVectors;
     std::vector<BearingVector> bearingVectors;
     std::vector<LinerSegment> linerSegments;
 };
 
-class AttributesManager {
+// LinerSegment는 AttributesManager에 추가될 때, 양 끝 node와 bearing이 manager의 것과 같으면
+// 이 manager를 공유 topology로 사용한다 (node/bearing 복사본 없음).
+// 따라서 getLinerSegments() 등으로 얻은 연결된 segment의 복사본은 manager보다 오래 살면 안 된다.
+//
+// 저장 방식: 각 종류는 빈칸 없는 연속 배열(dense array)에 저장하고, SlotIndex가 stable handle과
+// 배열 위치를 연결한다. 삭제는 마지막 원소를 삭제 위치로 옮기는 swap-and-pop이므로 O(1)이며,
+// 그 결과 getNodeVectors() 등의 배열 순서는 삭제 후 바뀔 수 있다. handle은 삭제 전까지 항상 유효하다.
+//
+// Thread 모델: 수정 함수와 get*() 접근자는 writer thread(main/render) 하나에서만 호출한다.
+// 다른 thread는 Snapshot()으로 마지막으로 publish된 읽기 전용 snapshot만 읽는다.
+class AttributesManager : public SegmentTopologySource {
 private:
-    std::vector<NodeVector> nodeVectors;
+    // segment의 점 배열을 할당하는 arena (segment보다 늦게 소멸해야 하므로 가장 먼저 선언)
+    SceneArena sceneArena;
+
+    NodeStore nodeVectors; // SoA 형태로 저장
     std::vector<BearingVector> bearingVectors;
     std::vector<LinerSegment> linerSegments;
 
+    // handle <-> 배열 위치
+    SlotIndex<NodeHandleTag> nodeSlots;
+    SlotIndex<BearingHandleTag> bearingSlots;
+    SlotIndex<SegmentHandleTag> segmentSlots;
+
+    // 사용자 index(i_n) -> node handle (같은 index가 여러 개면 먼저 추가된 node)
+    std::unordered_map<int, NodeHandle> nodeByIndex;
+    bool hasDuplicateNodeIndices; // 같은 index의 node가 추가된 적이 있는지 여부
+    // node -> bearing 인접 목록: node index -> 해당 node의 bearing handle (depth 오름차순, 같은 depth는 추가 순서)
+    // bearing 추가/수정/삭제 시 해당 node의 목록만 갱신한다.
+    // transaction 중에는 목록이 정렬되어 있지 않을 수 있으므로 조회 함수는 순서에 의존하지 않는다.
+    std::unordered_map<int, std::vector<BearingHandle>> bearingsByNode;
+    void InsertBearingAdjacency(int nodeIndex, BearingHandle handle);
+    // 목록을 (depth, handle)로 만들어 depth 순서로 안정 정렬
+    void SortByDepth(const std::vector<BearingHandle>& adjacency,
+                     std::vector<std::pair<int, BearingHandle>>& keyed) const;
+    // depth가 가장 작은 bearing (같은 depth는 먼저 추가된 것)
+    BearingHandle LowestDepthBearing(const std::vector<BearingHandle>& adjacency) const;
+
+    // 의존성 그래프: node index -> 해당 node를 양 끝으로 가지는 segment handle
+    std::unordered_map<int, std::vector<SegmentHandle>> segmentsByNode;
+    std::vector<SegmentHandle> dirtySegments; // 다시 샘플링이 필요한 segment (segment의 dirty 플래그가 처음 설정될 때 추가)
+
+    void AddSegmentDependencies(SegmentHandle handle, const LinerSegment& segment);
+    void RemoveSegmentDependencies(SegmentHandle handle, const LinerSegment& segment);
+    void MarkDependentsDirty(int nodeIndex);
+    void QueueIfNewlyDirty(SegmentHandle handle, LinerSegment& segment, bool wasDirty);
+    void ResampleSegments(const std::vector<std::size_t>& positions);
+
+    void MapNodeIndex(int nodeIndex, NodeHandle handle);
+    void UnmapNodeIndex(int nodeIndex, NodeHandle handle);
+    std::size_t NodePositionOf(int nodeIndex) const;
+    void AdoptSegment(SegmentHandle handle, LinerSegment& segment, bool wasDirty);
+
+    // 마지막으로 publish한 snapshot (std::atomic_load / std::atomic_store로만 접근)
+    std::shared_ptr<const AttributesSnapshot> publishedSnapshot;
+    // 마지막 publish 이후 바뀐 chunk 표시 (chunk 번호 = 배열 위치 / kSnapshotChunkSize)
+    std::vector<unsigned char> dirtyNodeChunks;
+    std::vector<unsigned char> dirtyBearingChunks;
+    std::vector<unsigned char> dirtySegmentChunks;
+    bool snapshotPending; // publish할 변경이 있는지 여부
+    void MarkChunk(std::vector<unsigned char>& dirtyChunks, std::size_t pos);
+
+    // transaction 중에는 인접 목록 정렬과 의존 segment 표시를 commit까지 미룸
+    int transactionDepth;
+    std::vector<int> pendingBearingNodes; // 인접 목록을 다시 정렬할 node index
+    std::vector<int> pendingDirtyNodes;   // 의존 segment를 dirty로 표시할 node index
+    void SortBearingAdjacency(int nodeIndex);
+
+    // transaction 중 CreateSampledLinerSegment로 추가한 segment와 추가 시점의 pendingDirtyNodes 크기
+    // (그 이후 양 끝 node가 바뀌지 않았으면 commit에서 dirty 표시를 되돌림)
+    struct PendingSampledSegment {
+        SegmentHandle handle;
+        std::size_t pendingMark;
+    };
+    std::vector<PendingSampledSegment> pendingSampledSegments;
+
 public:
     AttributesManager();
     ~AttributesManager();
 
-    // NodeVector 관련 함수
-    NodeVector CreateNodeVector(const NodeVector& node);
+    // segment가 manager 주소를 참조하므로 복사 불가
+    AttributesManager(const AttributesManager&) = delete;
+    AttributesManager& operator=(const AttributesManager&) = delete;
+
+    /**
+     * @brief 대량 수정을 시작합니다. 중첩 호출 가능하며 가장 바깥 CommitTransaction에서 반영된다.
+     *        transaction 중에는
+     *        - GetNodeBearings의 목록이 depth 순서가 아닐 수 있다 (FindBearingVector, 정수 index Edit/Delete,
+     *          segment 샘플링은 선형 탐색 / 지역 정렬로 commit 후와 같은 bearing을 찾는다).
+     *        - segment dirty 표시, FlushDirtySegments, PublishSnapshot은 commit까지 미뤄진다.
+     *
+     * @param extraNodes 추가할 NodeVector 수 (미리 용량 확보).
+     * @param extraBearings 추가할 BearingVector 수.
+     * @param extraSegments 추가할 LinerSegment 수.
+     */
+    void BeginTransaction(std::size_t extraNodes = 0, std::size_t extraBearings = 0, std::size_t extraSegments = 0);
+
+    /**
+     * @brief 미뤄 둔 인접 목록 정렬과 dirty 표시를 한 번에 처리하고,
+     *        영향받은 segment를 한 번 다시 샘플링한 뒤 snapshot을 한 번 publish합니다.
+     */
+    void CommitTransaction();
+    bool inTransaction() const { return transactionDepth > 0; }
+
+    // NodeVector 관련 함수 (int index는 사용자 index i_n)
+    NodeHandle CreateNodeVector(const NodeVector& node);
+    std::vector<NodeHandle> CreateNodeVectors(const std::vector<NodeVector>& nodes);
     bool EditNodeVector(int index, const NodeVector& newNode);
+    bool EditNodeVector(NodeHandle handle, const NodeVector& newNode);
     bool DeleteNodeVector(int index);
+    bool DeleteNodeVector(NodeHandle handle);
+    NodeHandle FindNodeVector(int index) const;
+    bool GetNodeVector(NodeHandle handle, NodeVector& node) const;
 
-    // BearingVector 관련 함수
-    BearingVector CreateBearingVector(const BearingVector& bearing);
+    // BearingVector 관련 함수 (int index는 node index, 해당 node에서 depth가 가장 작은 bearing을 대상으로 함)
+    BearingHandle CreateBearingVector(const BearingVector& bearing);
+    std::vector<BearingHandle> CreateBearingVectors(const std::vector<BearingVector>& bearings);
     bool EditBearingVector(int index, const BearingVector& newBearing);
+    bool EditBearingVector(BearingHandle handle, const BearingVector& newBearing);
     bool DeleteBearingVector(int index);
+    bool DeleteBearingVector(BearingHandle handle);
+    BearingHandle FindBearingVector(int nodeIndex, int depth) const;
+    const BearingVector* GetBearingVector(BearingHandle handle) const;
+    // node의 bearing handle 목록 (depth 오름차순, 연속 배열). 다음 bearing 수정 전까지만 유효
+    ConstSpan<BearingHandle> GetNodeBearings(int nodeIndex) const;
 
-    // LinerSegment 관련 함수
-    LinerSegment CreateLinerSegment(const LinerSegment& segment);
+    // LinerSegment 관련 함수 (int index는 getLinerSegments() 배열 위치)
+    // 다른 topology에 연결된 segment와, 복사본이 manager의 양 끝 node 좌표 / bearing (순서 포함)과 같은 segment는
+    // 이 manager의 topology에 연결되고 dirty로 표시된다. 그 밖의 segment (양 끝 node가 manager에 없거나
+    // segment에만 있는 bearing을 가진 경우)는 자기 복사본을 계속 사용하며, manager의 node/bearing 수정은
+    // index가 같은 복사본에 반영된다.
+    SegmentHandle CreateLinerSegment(const LinerSegment& segment);
+    // 이미 샘플링된 segment 추가 (scene 파일 등에서 읽은 control point / sample을 그대로 사용)
+    // transaction 중에 추가해도, 추가 이후 양 끝 node/bearing이 바뀌지 않으면 commit에서 다시 샘플링하지 않는다.
+    SegmentHandle CreateSampledLinerSegment(const LinerSegment& segment);
+    // 양 끝 node index로 이 manager에 연결된 segment를 샘플링하지 않고 추가 (YAML / scene 파일 import 등)
+    // dirty로 표시되어 다음 FlushDirtySegments (transaction 중이면 commit의 병렬 재샘플링)에서 한 번만 샘플링된다.
+    SegmentHandle CreateLinerSegment(int startNode, int endNode, float lod, float alphaVal = 0.5f);
     bool EditLinerSegment(int index, const LinerSegment& newSegment);
+    bool EditLinerSegment(SegmentHandle handle, const LinerSegment& newSegment);
     bool DeleteLinerSegment(int index);
+    bool DeleteLinerSegment(SegmentHandle handle);
+    const LinerSegment* GetLinerSegment(SegmentHandle handle) const;
+
+    // 모든 LinerSegment를 thread pool에서 다시 샘플링 (degree × LOD 비용 기준으로 분배)
+    // 각 segment는 자기 데이터만 수정하므로 결과는 thread 수와 실행 순서에 무관하다.
+    // transaction 중에는 모든 segment를 dirty로 표시하고 commit에서 샘플링한다.
+    void ResampleAllLinerSegments();
+    // 모든 LinerSegment의 LevelOfDetail을 바꾸고 한 번에 다시 샘플링
+    void SetLevelOfDetailForAll(float lod);
+
+    // Edit/Delete로 dirty가 된 segment만 한 번에 다시 샘플링 (처리한 개수 반환)
+    // flush 전까지 getLinerSegments()는 이전 샘플을 반환한다. 끝나면 snapshot을 publish한다.
+    // transaction 중에는 아무것도 하지 않고 0을 반환한다.
+    std::size_t FlushDirtySegments();
+    std::size_t getDirtySegmentCount() const { return dirtySegments.size(); }
+
+    // SegmentTopologySource 구현 (node index로 조회, bearing은 depth 오름차순)
+    bool NodePosition(int nodeIndex, Vector3& position) const override;
+    void BearingDirections(int nodeIndex, ScenePointVector& directions) const override;
+    NodeVector Node(int nodeIndex) const override;
+
+    /**
+     * @brief 마지막으로 publish된 snapshot을 반환합니다 (복사 없음, 어느 thread에서나 호출 가능).
+     *        반환된 snapshot은 이후 수정이나 publish와 무관하게 그대로 유지된다.
+     */
+    std::shared_ptr<const AttributesSnapshot> Snapshot() const;
+
+    /**
+     * @brief 마지막 publish 이후 바뀐 chunk만 새로 만들어 snapshot을 교체합니다 (writer thread 전용).
+     *        바뀐 것이 없으면 아무것도 하지 않는다.
+     */
+    void PublishSnapshot();
 
-    // Attributes 관련 함수
+    // Attributes 관련 함수 (ReadAllAttributes는 전체 복사본, writer thread 전용)
     Attributes ReadAllAttributes() const;
+    // 모든 데이터를 지우고 scene arena를 한 번에 해제 (이전에 얻은 segment 복사본은 사용할 수 없음)
     void DeleteAllAttributes();
 
     // 접근자 함수 추가
-    const std::vector<NodeVector>& getNodeVectors() const { return nodeVectors; }
+    const NodeStore& getNodeVectors() const { return nodeVectors; }
     const std::vector<BearingVector>& getBearingVectors() const { return bearingVectors; }
     const std::vector<LinerSegment>& getLinerSegments() const { return linerSegments; }
 };
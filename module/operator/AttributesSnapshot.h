@@ -0,0 +1,60 @@
+/* AttributesSnapshot.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * AttributesManager의 읽기 전용 snapshot (RCU 방식)
+ *
+ * Writer(main/render thread)는 AttributesManager::PublishSnapshot에서 새 snapshot을 만들어
+ * atomic하게 교체하고, reader(socket thread 등)는 shared_ptr 하나를 얻어 lock 없이 읽는다.
+ * snapshot은 만들어진 뒤 절대 수정되지 않으며, 마지막 reader가 놓으면 해제된다.
+ *
+ * 각 배열은 kSnapshotChunkSize 단위 chunk로 나뉘어 있고, 이전 publish 이후 바뀌지 않은
+ * chunk는 이전 snapshot과 공유한다 (chunk 단위 copy-on-write).
+ */
+
+#ifndef ATTRIBUTESSNAPSHOT_H
+#define ATTRIBUTESSNAPSHOT_H
+
+#include "NodeStore.h"
+#include "BearingVector.h"
+#include "LinerSegment.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// chunk 하나에 담는 원소 수
+constexpr std::size_t kSnapshotChunkSize = 256;
+
+/**
+ * @brief snapshot 안의 LinerSegment 값.
+ *        LinerSegment는 manager를 topology로 참조하므로, 양 끝 node를 포함한 값만 복사해 둔다.
+ */
+struct SegmentRecord {
+    LinerSegmentData data;
+    std::vector<Vector3> controlPoints;
+    std::vector<Vector3> sampledPoints;
+};
+
+template <typename Chunk>
+using SnapshotChunks = std::vector<std::shared_ptr<const Chunk>>;
+
+/**
+ * @brief 특정 version의 AttributesManager 상태.
+ *        chunk를 순서대로 이어 붙이면 getNodeVectors() 등의 배열 순서와 같다.
+ */
+struct AttributesSnapshot {
+    std::uint64_t version = 0; // publish마다 1씩 증가
+
+    std::size_t nodeCount = 0;
+    std::size_t bearingCount = 0;
+    std::size_t segmentCount = 0;
+
+    SnapshotChunks<NodeStore> nodeChunks;
+    SnapshotChunks<std::vector<BearingVector>> bearingChunks;
+    SnapshotChunks<std::vector<SegmentRecord>> segmentChunks;
+};
+
+#endif // ATTRIBUTESSNAPSHOT_H
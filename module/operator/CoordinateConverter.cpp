@@ -6,6 +6,14 @@
  */
 
 #include "CoordinateConverter.h"
+#include "CoordinateConverterKernels.h"
+#include "Profiler.h"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 
 /**
  * @brief SphericalVector를 CartesianVector로 변환합니다.
@@ -42,3 +50,190 @@ SphericalVector CoordinateConverter::cartesianToSpherical(const CartesianVector&
     float phi = (r == 0.0f) ? 0.0f : std::acos(cv.z / r);
     return SphericalVector(r, theta, phi);
 }
+
+// ---------------------------------------------------------------------------
+// Batch 변환 (SIMD 커널 + 런타임 디스패치)
+// ---------------------------------------------------------------------------
+
+namespace {
+
+// 비트 연산을 위한 float <-> uint32 변환
+inline std::uint32_t FloatBits(float v) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+inline float BitsFloat(std::uint32_t bits) {
+    float v;
+    std::memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+// Scalar traits (1 lane). 마스크는 모든 비트가 1인 float로 표현
+struct ScalarTraits {
+    using Float = float;
+    using Int = std::int32_t;
+    static constexpr std::size_t kWidth = 1;
+
+    static Float Set1(float v) { return v; }
+    static Float Load(const float* p) { return *p; }
+    static void Store(float* p, Float v) { *p = v; }
+    static Float Add(Float a, Float b) { return a + b; }
+    static Float Sub(Float a, Float b) { return a - b; }
+    static Float Mul(Float a, Float b) { return a * b; }
+    static Float Div(Float a, Float b) { return a / b; }
+    static Float Sqrt(Float a) { return std::sqrt(a); }
+    static Float MulAdd(Float a, Float b, Float c) { return a * b + c; }
+    static Float Min(Float a, Float b) { return a < b ? a : b; }
+    static Float Max(Float a, Float b) { return a > b ? a : b; }
+    static Float And(Float a, Float b) { return BitsFloat(FloatBits(a) & FloatBits(b)); }
+    static Float Or(Float a, Float b) { return BitsFloat(FloatBits(a) | FloatBits(b)); }
+    static Float Xor(Float a, Float b) { return BitsFloat(FloatBits(a) ^ FloatBits(b)); }
+    static Float AndNot(Float a, Float b) { return BitsFloat(~FloatBits(a) & FloatBits(b)); }
+    static Float Mask(bool v) { return BitsFloat(v ? 0xFFFFFFFFu : 0u); }
+    static Float CmpLt(Float a, Float b) { return Mask(a < b); }
+    static Float CmpGt(Float a, Float b) { return Mask(a > b); }
+    static Float CmpEq(Float a, Float b) { return Mask(a == b); }
+    static Float Select(Float mask, Float a, Float b) { return FloatBits(mask) ? a : b; }
+
+    static Int SetI1(int v) { return v; }
+    static Int ToIntTrunc(Float a) { return static_cast<Int>(a); }
+    static Float ToFloat(Int a) { return static_cast<float>(a); }
+    static Int AddI(Int a, Int b) { return a + b; }
+    static Int SubI(Int a, Int b) { return a - b; }
+    static Int AndI(Int a, Int b) { return a & b; }
+    static Int AndNotI(Int a, Int b) { return ~a & b; }
+    static Int ShiftLeft29(Int a) { return static_cast<Int>(static_cast<std::uint32_t>(a) << 29); }
+    static Int CmpEqI(Int a, Int b) { return a == b ? -1 : 0; }
+    static Float AsFloat(Int a) { return BitsFloat(static_cast<std::uint32_t>(a)); }
+};
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define COORDINATECONVERTER_HAS_SSE2 1
+// SSE2 traits (4 lanes)
+struct Sse2Traits {
+    using Float = __m128;
+    using Int = __m128i;
+    static constexpr std::size_t kWidth = 4;
+
+    static Float Set1(float v) { return _mm_set1_ps(v); }
+    static Float Load(const float* p) { return _mm_loadu_ps(p); }
+    static void Store(float* p, Float v) { _mm_storeu_ps(p, v); }
+    static Float Add(Float a, Float b) { return _mm_add_ps(a, b); }
+    static Float Sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+    static Float Mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+    static Float Div(Float a, Float b) { return _mm_div_ps(a, b); }
+    static Float Sqrt(Float a) { return _mm_sqrt_ps(a); }
+    static Float MulAdd(Float a, Float b, Float c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static Float Min(Float a, Float b) { return _mm_min_ps(a, b); }
+    static Float Max(Float a, Float b) { return _mm_max_ps(a, b); }
+    static Float And(Float a, Float b) { return _mm_and_ps(a, b); }
+    static Float Or(Float a, Float b) { return _mm_or_ps(a, b); }
+    static Float Xor(Float a, Float b) { return _mm_xor_ps(a, b); }
+    static Float AndNot(Float a, Float b) { return _mm_andnot_ps(a, b); }
+    static Float CmpLt(Float a, Float b) { return _mm_cmplt_ps(a, b); }
+    static Float CmpGt(Float a, Float b) { return _mm_cmpgt_ps(a, b); }
+    static Float CmpEq(Float a, Float b) { return _mm_cmpeq_ps(a, b); }
+    static Float Select(Float mask, Float a, Float b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+    static Int SetI1(int v) { return _mm_set1_epi32(v); }
+    static Int ToIntTrunc(Float a) { return _mm_cvttps_epi32(a); }
+    static Float ToFloat(Int a) { return _mm_cvtepi32_ps(a); }
+    static Int AddI(Int a, Int b) { return _mm_add_epi32(a, b); }
+    static Int SubI(Int a, Int b) { return _mm_sub_epi32(a, b); }
+    static Int AndI(Int a, Int b) { return _mm_and_si128(a, b); }
+    static Int AndNotI(Int a, Int b) { return _mm_andnot_si128(a, b); }
+    static Int ShiftLeft29(Int a) { return _mm_slli_epi32(a, 29); }
+    static Int CmpEqI(Int a, Int b) { return _mm_cmpeq_epi32(a, b); }
+    static Float AsFloat(Int a) { return _mm_castsi128_ps(a); }
+};
+#endif
+
+using BatchKernel = CoordinateConverter::BatchKernel;
+
+// CPU가 해당 커널을 지원하는지 확인
+bool IsKernelSupported(BatchKernel kernel) {
+    switch (kernel) {
+    case BatchKernel::Scalar:
+        return true;
+    case BatchKernel::Sse2:
+#ifdef COORDINATECONVERTER_HAS_SSE2
+        return true;
+#else
+        return false;
+#endif
+    case BatchKernel::Avx2:
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        return CoordinateConverterKernels::Avx2KernelsCompiled() &&
+               __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+// 지원되는 가장 넓은 커널 선택
+BatchKernel DetectBatchKernel() {
+    if (IsKernelSupported(BatchKernel::Avx2)) return BatchKernel::Avx2;
+    if (IsKernelSupported(BatchKernel::Sse2)) return BatchKernel::Sse2;
+    return BatchKernel::Scalar;
+}
+
+std::atomic<BatchKernel>& SelectedKernel() {
+    static std::atomic<BatchKernel> kernel(DetectBatchKernel());
+    return kernel;
+}
+
+} // namespace
+
+void CoordinateConverter::sphericalToCartesian(const float* r, const float* theta, const float* phi,
+                                               float* x, float* y, float* z, std::size_t count) {
+    PROFILE_SCOPE("CoordinateConverter::sphericalToCartesian (batch)");
+    switch (SelectedKernel().load(std::memory_order_relaxed)) {
+    case BatchKernel::Avx2:
+        if (CoordinateConverterKernels::SphericalToCartesianAvx2(r, theta, phi, x, y, z, count)) return;
+        break;
+    case BatchKernel::Sse2:
+#ifdef COORDINATECONVERTER_HAS_SSE2
+        CoordinateConverterKernels::SphericalToCartesianArray<Sse2Traits>(r, theta, phi, x, y, z, count);
+        return;
+#else
+        break;
+#endif
+    case BatchKernel::Scalar:
+        break;
+    }
+    CoordinateConverterKernels::SphericalToCartesianArray<ScalarTraits>(r, theta, phi, x, y, z, count);
+}
+
+void CoordinateConverter::cartesianToSpherical(const float* x, const float* y, const float* z,
+                                               float* r, float* theta, float* phi, std::size_t count) {
+    PROFILE_SCOPE("CoordinateConverter::cartesianToSpherical (batch)");
+    switch (SelectedKernel().load(std::memory_order_relaxed)) {
+    case BatchKernel::Avx2:
+        if (CoordinateConverterKernels::CartesianToSphericalAvx2(x, y, z, r, theta, phi, count)) return;
+        break;
+    case BatchKernel::Sse2:
+#ifdef COORDINATECONVERTER_HAS_SSE2
+        CoordinateConverterKernels::CartesianToSphericalArray<Sse2Traits>(x, y, z, r, theta, phi, count);
+        return;
+#else
+        break;
+#endif
+    case BatchKernel::Scalar:
+        break;
+    }
+    CoordinateConverterKernels::CartesianToSphericalArray<ScalarTraits>(x, y, z, r, theta, phi, count);
+}
+
+CoordinateConverter::BatchKernel CoordinateConverter::activeBatchKernel() {
+    return SelectedKernel().load(std::memory_order_relaxed);
+}
+
+bool CoordinateConverter::setBatchKernel(BatchKernel kernel) {
+    if (!IsKernelSupported(kernel)) return false;
+    SelectedKernel().store(kernel, std::memory_order_relaxed);
+    return true;
+}
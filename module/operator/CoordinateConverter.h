@@ -11,12 +11,23 @@
  * Equ(1): x = r * sin(phi) * cos(theta)
  * Equ(2): y = r * sin(phi) * sin(theta)
  * Equ(3): z = r * cos(phi)
+ *
+ * Batch 변환
+ * 배열 단위 변환은 SIMD 커널(AVX2 / SSE2)을 런타임에 선택하고, 지원하지 않는
+ * 환경에서는 같은 다항식을 쓰는 scalar 경로를 사용한다.
+ * 오차 한계 (double로 계산한 기준값 대비, |angle| < 8192 rad):
+ *   sin/cos: 최대 2 ULP (결과가 0에 가까운 경우 절대 오차 < 1.2e-7)
+ *   atan2:   최대 3 ULP
+ *   acos:    최대 1 ULP (z / r 계산의 반올림 오차는 별도)
+ *   x, y, z: 성분당 최대 4 ULP, 0에 가까운 성분은 절대 오차 < 1.7e-7 * r
+ *   r:       최대 1 ULP
  */
 
 #ifndef COORDINATECONVERTER_H
 #define COORDINATECONVERTER_H
 
 #include <cmath>
+#include <cstddef>
 
 /**
  * @brief Structure representing a Spherical Vector.
@@ -77,6 +88,47 @@ public:
      * @return SphericalVector 변환된 SphericalVector 객체.
      */
     static SphericalVector cartesianToSpherical(const CartesianVector& cv);
+
+    /**
+     * @brief Batch 변환에 사용되는 커널 종류.
+     */
+    enum class BatchKernel {
+        Scalar, ///< Portable scalar fallback
+        Sse2,   ///< x86 SSE2 (4 lanes)
+        Avx2    ///< x86 AVX2 + FMA (8 lanes)
+    };
+
+    /**
+     * @brief Spherical 배열을 Cartesian 배열로 변환합니다 (SoA, array-in/array-out).
+     *
+     * @param r, theta, phi 입력 배열 (count개).
+     * @param x, y, z 출력 배열 (count개). 입력과 겹치면 안 됨.
+     * @param count 원소 개수.
+     */
+    static void sphericalToCartesian(const float* r, const float* theta, const float* phi,
+                                     float* x, float* y, float* z, std::size_t count);
+
+    /**
+     * @brief Cartesian 배열을 Spherical 배열로 변환합니다 (SoA, array-in/array-out).
+     *        r = 0 인 원소는 phi = 0, x = y = 0 인 원소는 theta = ±0.
+     *
+     * @param x, y, z 입력 배열 (count개).
+     * @param r, theta, phi 출력 배열 (count개). 입력과 겹치면 안 됨.
+     * @param count 원소 개수.
+     */
+    static void cartesianToSpherical(const float* x, const float* y, const float* z,
+                                     float* r, float* theta, float* phi, std::size_t count);
+
+    /**
+     * @brief 현재 CPU에서 batch 변환에 사용되는 커널을 반환합니다.
+     */
+    static BatchKernel activeBatchKernel();
+
+    /**
+     * @brief batch 변환 커널을 강제로 지정합니다 (테스트/벤치마크용).
+     *        CPU가 지원하지 않는 커널을 지정하면 false를 반환하고 변경하지 않습니다.
+     */
+    static bool setBatchKernel(BatchKernel kernel);
 };
 
 #endif // COORDINATECONVERTER_H
@@ -0,0 +1,101 @@
+/* CoordinateConverterAvx2.cpp
+ * Linked file CoordinateConverterKernels.h
+ * Security: Confidential
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose
+ * AVX2 + FMA 배열 변환 커널 (8 lanes)
+ * x86에서는 CMakeLists.txt에서 이 파일만 -mavx2 -mfma로 컴파일하고,
+ * 실제 사용 여부는 CoordinateConverter.cpp에서 런타임 CPU 검사로 결정한다.
+ */
+
+#include "CoordinateConverterKernels.h"
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+
+namespace {
+
+// AVX2 traits
+struct Avx2Traits {
+    using Float = __m256;
+    using Int = __m256i;
+    static constexpr std::size_t kWidth = 8;
+
+    static Float Set1(float v) { return _mm256_set1_ps(v); }
+    static Float Load(const float* p) { return _mm256_loadu_ps(p); }
+    static void Store(float* p, Float v) { _mm256_storeu_ps(p, v); }
+    static Float Add(Float a, Float b) { return _mm256_add_ps(a, b); }
+    static Float Sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+    static Float Mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+    static Float Div(Float a, Float b) { return _mm256_div_ps(a, b); }
+    static Float Sqrt(Float a) { return _mm256_sqrt_ps(a); }
+    static Float MulAdd(Float a, Float b, Float c) { return _mm256_fmadd_ps(a, b, c); }
+    static Float Min(Float a, Float b) { return _mm256_min_ps(a, b); }
+    static Float Max(Float a, Float b) { return _mm256_max_ps(a, b); }
+    static Float And(Float a, Float b) { return _mm256_and_ps(a, b); }
+    static Float Or(Float a, Float b) { return _mm256_or_ps(a, b); }
+    static Float Xor(Float a, Float b) { return _mm256_xor_ps(a, b); }
+    static Float AndNot(Float a, Float b) { return _mm256_andnot_ps(a, b); }
+    static Float CmpLt(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Float CmpGt(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static Float CmpEq(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    static Float Select(Float mask, Float a, Float b) { return _mm256_blendv_ps(b, a, mask); }
+
+    static Int SetI1(int v) { return _mm256_set1_epi32(v); }
+    static Int ToIntTrunc(Float a) { return _mm256_cvttps_epi32(a); }
+    static Float ToFloat(Int a) { return _mm256_cvtepi32_ps(a); }
+    static Int AddI(Int a, Int b) { return _mm256_add_epi32(a, b); }
+    static Int SubI(Int a, Int b) { return _mm256_sub_epi32(a, b); }
+    static Int AndI(Int a, Int b) { return _mm256_and_si256(a, b); }
+    static Int AndNotI(Int a, Int b) { return _mm256_andnot_si256(a, b); }
+    static Int ShiftLeft29(Int a) { return _mm256_slli_epi32(a, 29); }
+    static Int CmpEqI(Int a, Int b) { return _mm256_cmpeq_epi32(a, b); }
+    static Float AsFloat(Int a) { return _mm256_castsi256_ps(a); }
+};
+
+} // namespace
+
+namespace CoordinateConverterKernels {
+
+bool Avx2KernelsCompiled() {
+    return true;
+}
+
+bool SphericalToCartesianAvx2(const float* r, const float* theta, const float* phi,
+                              float* x, float* y, float* z, std::size_t count) {
+    SphericalToCartesianArray<Avx2Traits>(r, theta, phi, x, y, z, count);
+    return true;
+}
+
+bool CartesianToSphericalAvx2(const float* x, const float* y, const float* z,
+                              float* r, float* theta, float* phi, std::size_t count) {
+    CartesianToSphericalArray<Avx2Traits>(x, y, z, r, theta, phi, count);
+    return true;
+}
+
+} // namespace CoordinateConverterKernels
+
+#else
+
+namespace CoordinateConverterKernels {
+
+// AVX2 플래그 없이 컴파일된 경우 (non-x86 등): 호출자가 다른 경로를 사용
+bool Avx2KernelsCompiled() {
+    return false;
+}
+
+bool SphericalToCartesianAvx2(const float*, const float*, const float*,
+                              float*, float*, float*, std::size_t) {
+    return false;
+}
+
+bool CartesianToSphericalAvx2(const float*, const float*, const float*,
+                              float*, float*, float*, std::size_t) {
+    return false;
+}
+
+} // namespace CoordinateConverterKernels
+
+#endif
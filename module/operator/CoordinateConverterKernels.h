@@ -0,0 +1,266 @@
+/* CoordinateConverterKernels.h
+ * Linked file CoordinateConverter.cpp, CoordinateConverterAvx2.cpp
+ * Security: Confidential
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose
+ * 배열 단위 SphericalVector <-> CartesianVector 변환 커널 (내부용 헤더)
+ *
+ * 커널은 SIMD traits(S)를 템플릿 인자로 받아 Scalar / SSE2 / AVX2 에서 동일한
+ * 알고리즘으로 인스턴스화된다. traits 타입은 각 translation unit의 익명
+ * namespace에 정의해야 한다 (ISA별 인스턴스가 서로 섞이지 않도록).
+ *
+ * sin/cos, atan, asin 다항식은 Cephes single precision 구현을 따른다.
+ *
+ * traits S 요구사항
+ *   S::Float, S::Int, S::kWidth
+ *   Set1, Load, Store, Add, Sub, Mul, Div, Sqrt, MulAdd, Min, Max
+ *   And, Or, Xor, AndNot(a, b) = ~a & b, CmpLt, CmpGt, CmpEq, Select(mask, a, b)
+ *   SetI1, ToIntTrunc, ToFloat, AddI, SubI, AndI, AndNotI, ShiftLeft29, CmpEqI, AsFloat
+ *
+ * 이 헤더는 AVX2 플래그로 컴파일되는 translation unit에서도 포함되므로
+ * 템플릿 외의 inline 함수나 표준 라이브러리 헤더를 추가하지 말 것.
+ */
+
+#ifndef COORDINATECONVERTERKERNELS_H
+#define COORDINATECONVERTERKERNELS_H
+
+#include <cstddef>
+
+namespace CoordinateConverterKernels {
+
+// Cephes 상수
+constexpr float kFourOverPi = 1.27323954473516f;
+constexpr float kMinusDP1 = -0.78515625f;
+constexpr float kMinusDP2 = -2.4187564849853515625e-4f;
+constexpr float kMinusDP3 = -3.77489497744594108e-8f;
+constexpr float kSinP0 = -1.9515295891e-4f;
+constexpr float kSinP1 = 8.3321608736e-3f;
+constexpr float kSinP2 = -1.6666654611e-1f;
+constexpr float kCosP0 = 2.443315711809948e-5f;
+constexpr float kCosP1 = -1.388731625493765e-3f;
+constexpr float kCosP2 = 4.166664568298827e-2f;
+constexpr float kAtanP0 = 8.05374449538e-2f;
+constexpr float kAtanP1 = -1.38776856032e-1f;
+constexpr float kAtanP2 = 1.99777106478e-1f;
+constexpr float kAtanP3 = -3.33329491539e-1f;
+constexpr float kAsinP0 = 4.2163199048e-2f;
+constexpr float kAsinP1 = 2.4181311049e-2f;
+constexpr float kAsinP2 = 4.5470025998e-2f;
+constexpr float kAsinP3 = 7.4953002686e-2f;
+constexpr float kAsinP4 = 1.6666752422e-1f;
+constexpr float kTanPiOver8 = 0.4142135623730950f;
+constexpr float kPi = 3.14159265358979f;
+constexpr float kPiOver2 = 1.57079632679490f;
+constexpr float kPiOver4 = 0.78539816339745f;
+constexpr unsigned kSignMask = 0x80000000u;
+
+/**
+ * @brief sin(x), cos(x)를 동시에 계산 (Cephes sinf/cosf, |x| < 8192 에서 유효).
+ */
+template <class S>
+void SinCos(typename S::Float x, typename S::Float& sinOut, typename S::Float& cosOut) {
+    using F = typename S::Float;
+    using I = typename S::Int;
+
+    const F signMask = S::AsFloat(S::SetI1(static_cast<int>(kSignMask)));
+    F signSin = S::And(x, signMask);
+    x = S::AndNot(signMask, x); // |x|
+
+    // 사분면 계산: j = (int(|x| * 4/pi) + 1) & ~1
+    I j = S::ToIntTrunc(S::Mul(x, S::Set1(kFourOverPi)));
+    j = S::AddI(j, S::SetI1(1));
+    j = S::AndNotI(S::SetI1(1), j);
+    F y = S::ToFloat(j);
+
+    // sin 부호 반전 및 다항식 선택 마스크
+    F swapSignSin = S::AsFloat(S::ShiftLeft29(S::AndI(j, S::SetI1(4))));
+    F polyMask = S::AsFloat(S::CmpEqI(S::AndI(j, S::SetI1(2)), S::SetI1(0)));
+    F signCos = S::AsFloat(S::ShiftLeft29(S::AndNotI(S::SubI(j, S::SetI1(2)), S::SetI1(4))));
+    signSin = S::Xor(signSin, swapSignSin);
+
+    // 확장 정밀도 범위 축소: x = ((x - y*DP1) - y*DP2) - y*DP3
+    x = S::MulAdd(y, S::Set1(kMinusDP1), x);
+    x = S::MulAdd(y, S::Set1(kMinusDP2), x);
+    x = S::MulAdd(y, S::Set1(kMinusDP3), x);
+    F z = S::Mul(x, x);
+
+    // cos 다항식
+    F c = S::MulAdd(S::Set1(kCosP0), z, S::Set1(kCosP1));
+    c = S::MulAdd(c, z, S::Set1(kCosP2));
+    c = S::Mul(c, S::Mul(z, z));
+    c = S::MulAdd(z, S::Set1(-0.5f), c);
+    c = S::Add(c, S::Set1(1.0f));
+
+    // sin 다항식
+    F s = S::MulAdd(S::Set1(kSinP0), z, S::Set1(kSinP1));
+    s = S::MulAdd(s, z, S::Set1(kSinP2));
+    s = S::MulAdd(S::Mul(s, z), x, x);
+
+    sinOut = S::Xor(S::Select(polyMask, s, c), signSin);
+    cosOut = S::Xor(S::Select(polyMask, c, s), signCos);
+}
+
+/**
+ * @brief atan2(y, x) (Cephes atanf 기반). x = y = 0 이면 ±0을 반환.
+ */
+template <class S>
+typename S::Float Atan2(typename S::Float y, typename S::Float x) {
+    using F = typename S::Float;
+
+    const F signMask = S::AsFloat(S::SetI1(static_cast<int>(kSignMask)));
+    const F zero = S::Set1(0.0f);
+    F ax = S::AndNot(signMask, x);
+    F ay = S::AndNot(signMask, y);
+
+    // t = min / max ∈ [0, 1], 분모가 0이면 0
+    F num = S::Min(ax, ay);
+    F den = S::Max(ax, ay);
+    F denZero = S::CmpEq(den, zero);
+    F t = S::Div(num, S::Select(denZero, S::Set1(1.0f), den));
+
+    // t > tan(pi/8) 이면 (t - 1) / (t + 1) + pi/4
+    F big = S::CmpGt(t, S::Set1(kTanPiOver8));
+    F reduced = S::Div(S::Sub(t, S::Set1(1.0f)), S::Add(t, S::Set1(1.0f)));
+    t = S::Select(big, reduced, t);
+    F offset = S::And(big, S::Set1(kPiOver4));
+
+    F z = S::Mul(t, t);
+    F p = S::MulAdd(S::Set1(kAtanP0), z, S::Set1(kAtanP1));
+    p = S::MulAdd(p, z, S::Set1(kAtanP2));
+    p = S::MulAdd(p, z, S::Set1(kAtanP3));
+    F a = S::Add(S::MulAdd(S::Mul(p, z), t, t), offset);
+
+    // 사분면 복원
+    a = S::Select(S::CmpGt(ay, ax), S::Sub(S::Set1(kPiOver2), a), a);
+    a = S::Select(S::CmpLt(x, zero), S::Sub(S::Set1(kPi), a), a);
+    return S::Xor(a, S::And(y, signMask));
+}
+
+/**
+ * @brief acos(v), v는 [-1, 1]로 clamp 된 값 (Cephes asinf 기반).
+ */
+template <class S>
+typename S::Float Acos(typename S::Float v) {
+    using F = typename S::Float;
+
+    const F signMask = S::AsFloat(S::SetI1(static_cast<int>(kSignMask)));
+    F a = S::AndNot(signMask, v);
+    F big = S::CmpGt(a, S::Set1(0.5f));
+
+    // |v| > 0.5 이면 asin(sqrt((1 - |v|) / 2)) 를 이용
+    F zBig = S::Mul(S::Set1(0.5f), S::Sub(S::Set1(1.0f), a));
+    F z = S::Select(big, zBig, S::Mul(a, a));
+    F s = S::Select(big, S::Sqrt(zBig), a);
+
+    F p = S::MulAdd(S::Set1(kAsinP0), z, S::Set1(kAsinP1));
+    p = S::MulAdd(p, z, S::Set1(kAsinP2));
+    p = S::MulAdd(p, z, S::Set1(kAsinP3));
+    p = S::MulAdd(p, z, S::Set1(kAsinP4));
+    p = S::MulAdd(S::Mul(p, z), s, s); // asin(s)
+
+    F negative = S::CmpLt(v, S::Set1(0.0f));
+    F twoP = S::Add(p, p);
+    F resultBig = S::Select(negative, S::Sub(S::Set1(kPi), twoP), twoP);
+    F resultSmall = S::Sub(S::Set1(kPiOver2), S::Xor(p, S::And(v, signMask)));
+    return S::Select(big, resultBig, resultSmall);
+}
+
+/**
+ * @brief Equ(1)~(3): x = r sin(phi) cos(theta), y = r sin(phi) sin(theta), z = r cos(phi)
+ */
+template <class S>
+void SphericalToCartesianBlock(const float* r, const float* theta, const float* phi,
+                               float* x, float* y, float* z) {
+    using F = typename S::Float;
+    F vr = S::Load(r);
+    F sinTheta, cosTheta, sinPhi, cosPhi;
+    SinCos<S>(S::Load(theta), sinTheta, cosTheta);
+    SinCos<S>(S::Load(phi), sinPhi, cosPhi);
+    F rSinPhi = S::Mul(vr, sinPhi);
+    S::Store(x, S::Mul(rSinPhi, cosTheta));
+    S::Store(y, S::Mul(rSinPhi, sinTheta));
+    S::Store(z, S::Mul(vr, cosPhi));
+}
+
+/**
+ * @brief r = sqrt(x^2 + y^2 + z^2), theta = atan2(y, x), phi = acos(z / r) (r = 0 이면 0)
+ */
+template <class S>
+void CartesianToSphericalBlock(const float* x, const float* y, const float* z,
+                               float* r, float* theta, float* phi) {
+    using F = typename S::Float;
+    F vx = S::Load(x);
+    F vy = S::Load(y);
+    F vz = S::Load(z);
+    F vr = S::Sqrt(S::MulAdd(vz, vz, S::MulAdd(vy, vy, S::Mul(vx, vx))));
+    F rZero = S::CmpEq(vr, S::Set1(0.0f));
+    F cosPhi = S::Div(vz, S::Select(rZero, S::Set1(1.0f), vr));
+    cosPhi = S::Max(S::Set1(-1.0f), S::Min(S::Set1(1.0f), cosPhi));
+    S::Store(r, vr);
+    S::Store(theta, Atan2<S>(vy, vx));
+    S::Store(phi, S::AndNot(rZero, Acos<S>(cosPhi)));
+}
+
+/**
+ * @brief count개의 원소를 변환. 마지막 kWidth 미만의 꼬리는 임시 버퍼로 처리.
+ */
+template <class S>
+void SphericalToCartesianArray(const float* r, const float* theta, const float* phi,
+                               float* x, float* y, float* z, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + S::kWidth <= count; i += S::kWidth) {
+        SphericalToCartesianBlock<S>(r + i, theta + i, phi + i, x + i, y + i, z + i);
+    }
+    if (i < count) {
+        alignas(64) float in[3][S::kWidth] = {};
+        alignas(64) float out[3][S::kWidth];
+        for (std::size_t k = 0; i + k < count; ++k) {
+            in[0][k] = r[i + k];
+            in[1][k] = theta[i + k];
+            in[2][k] = phi[i + k];
+        }
+        SphericalToCartesianBlock<S>(in[0], in[1], in[2], out[0], out[1], out[2]);
+        for (std::size_t k = 0; i + k < count; ++k) {
+            x[i + k] = out[0][k];
+            y[i + k] = out[1][k];
+            z[i + k] = out[2][k];
+        }
+    }
+}
+
+template <class S>
+void CartesianToSphericalArray(const float* x, const float* y, const float* z,
+                               float* r, float* theta, float* phi, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + S::kWidth <= count; i += S::kWidth) {
+        CartesianToSphericalBlock<S>(x + i, y + i, z + i, r + i, theta + i, phi + i);
+    }
+    if (i < count) {
+        alignas(64) float in[3][S::kWidth] = {};
+        alignas(64) float out[3][S::kWidth];
+        for (std::size_t k = 0; i + k < count; ++k) {
+            in[0][k] = x[i + k];
+            in[1][k] = y[i + k];
+            in[2][k] = z[i + k];
+        }
+        CartesianToSphericalBlock<S>(in[0], in[1], in[2], out[0], out[1], out[2]);
+        for (std::size_t k = 0; i + k < count; ++k) {
+            r[i + k] = out[0][k];
+            theta[i + k] = out[1][k];
+            phi[i + k] = out[2][k];
+        }
+    }
+}
+
+// AVX2 translation unit에서 제공하는 진입점 (AVX2 플래그 없이 빌드되면 false 반환)
+bool Avx2KernelsCompiled();
+bool SphericalToCartesianAvx2(const float* r, const float* theta, const float* phi,
+                              float* x, float* y, float* z, std::size_t count);
+bool CartesianToSphericalAvx2(const float* x, const float* y, const float* z,
+                              float* r, float* theta, float* phi, std::size_t count);
+
+} // namespace CoordinateConverterKernels
+
+#endif // COORDINATECONVERTERKERNELS_H
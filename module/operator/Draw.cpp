@@ -5,6 +5,7 @@
  * Date: Oct 20, 2024
  */
 #include "Draw.h"
+#include "Profiler.h"
 #ifdef __APPLE__
 #include <GLUT/glut.h>   // MacOS 환경
 #else
@@ -53,11 +54,11 @@ void Draw::DrawNodeVector() {
     const auto& nodeVectors = attributesManager.getNodeVectors();
     if (nodeVectors.empty()) return;
 
-    for (const auto& node : nodeVectors) {
+    // Cartesian 배열만 순회 (Spherical 데이터는 읽지 않음)
+    NodeCartesianView cartNodes = nodeVectors.cartesian();
+    for (std::size_t i = 0; i < cartNodes.size; ++i) {
         glColor3f(0.0f, 1.0f, 0.0f);  // 녹색
-        CartesianNodeVector cartNode = node.GetCartesianNodeVector();
-        // 수정: x_i_n, y_i_n, z_i_n 대신 cartesianCoords.x, cartesianCoords.y, cartesianCoords.z 사용
-        DrawPoint(cartNode.cartesianCoords.x, cartNode.cartesianCoords.y, cartNode.cartesianCoords.z, 10.0f);
+        DrawPoint(cartNodes.x[i], cartNodes.y[i], cartNodes.z[i], 10.0f);
     }
 }
 
@@ -66,25 +67,21 @@ void Draw::DrawBearingVector() {
     const auto& bearingVectors = attributesManager.getBearingVectors();
     if (bearingVectors.empty()) return;
 
+    // 베어링 벡터 위치 그리기 (청록색 점)
+    glColor3f(0.0f, 1.0f, 1.0f);  // 청록색
     for (const auto& bearing : bearingVectors) {
-        CartesianBearingVector cartBearing = bearing.convertToCartesianBearingVector();
-
-        // 베어링 벡터 위치 그리기 (청록색 점)
-        glColor3f(0.0f, 1.0f, 1.0f);  // 청록색
-        // 수정: cartBearing.x, cartBearing.y, cartBearing.z 대신 cartBearing.cartesianCoords.x, y, z 사용
-        DrawPoint(cartBearing.cartesianCoords.x, cartBearing.cartesianCoords.y, cartBearing.cartesianCoords.z, 8.0f);
-
-        // 노드와 베어링 벡터 사이의 선 그리기
-        int nodeIndex = bearing.getNodeIndex() - 1; // 인덱스 조정
-        const auto& nodeVectors = attributesManager.getNodeVectors();
-        if (nodeIndex >= 0 && nodeIndex < nodeVectors.size()) {
-            CartesianNodeVector cartNode = nodeVectors[nodeIndex].GetCartesianNodeVector();
-            // 수정: x_i_n, y_i_n, z_i_n 대신 cartesianCoords.x, cartesianCoords.y, cartesianCoords.z 사용
-            Vector3 nodePos(cartNode.cartesianCoords.x, cartNode.cartesianCoords.y, cartNode.cartesianCoords.z);
-            Vector3 bearingPos(cartBearing.cartesianCoords.x, cartBearing.cartesianCoords.y, cartBearing.cartesianCoords.z);
-
-            glColor3f(0.0f, 1.0f, 0.0f); // 녹색
-            DrawLine(nodePos, bearingPos, 2.0f);
+        const Vector3& bearingPos = bearing.getCartesianBearingVector().cartesianCoords;
+        DrawPoint(bearingPos.x, bearingPos.y, bearingPos.z, 8.0f);
+    }
+
+    // 노드와 베어링 벡터 사이의 선 그리기 (node별 인접 목록으로 해당 node의 bearing만 조회)
+    glColor3f(0.0f, 1.0f, 0.0f); // 녹색
+    NodeCartesianView cartNodes = attributesManager.getNodeVectors().cartesian();
+    for (std::size_t i = 0; i < cartNodes.size; ++i) {
+        Vector3 nodePos(cartNodes.x[i], cartNodes.y[i], cartNodes.z[i]);
+        for (BearingHandle handle : attributesManager.GetNodeBearings(cartNodes.index[i])) {
+            const BearingVector* bearing = attributesManager.GetBearingVector(handle);
+            DrawLine(nodePos, bearing->getCartesianBearingVector().cartesianCoords, 2.0f);
         }
     }
 }
@@ -95,14 +92,11 @@ void Draw::DrawForce() {
     if (bearingVectors.empty()) return;
 
     for (const auto& bearing : bearingVectors) {
-        CartesianBearingVector cartBearing = bearing.convertToCartesianBearingVector();
-        Vector3 bearingPos(cartBearing.cartesianCoords.x, cartBearing.cartesianCoords.y, cartBearing.cartesianCoords.z);
-        BearingVectorForce force = bearing.getForce();
+        const CartesianBearingVector& cartBearing = bearing.getCartesianBearingVector();
+        const Vector3& bearingPos = cartBearing.cartesianCoords;
 
         // 힘 벡터 (빨간색)
-        // 수정: f_x, f_y, f_z 대신 Force.x, Force.y, Force.z 사용
-        Vector3 forceVec(force.Force.x, force.Force.y, force.Force.z);
-        Vector3 forceEnd = bearingPos + forceVec;
+        Vector3 forceEnd = bearingPos + cartBearing.force.Force;
 
         glColor3f(1.0f, 0.0f, 0.0f);  // 빨간색
         DrawLine(bearingPos, forceEnd, 2.0f);
@@ -116,7 +110,7 @@ void Draw::DrawSamplePoint() {
 
     glColor3f(0.5f, 0.5f, 0.5f);  // 회색
     for (const auto& segment : linerSegments) {
-        const std::vector<Vector3>& sampledPoints = segment.getSampledPoints();
+        const ScenePointVector& sampledPoints = segment.getSampledPoints();
         for (const auto& point : sampledPoints) {
             DrawPoint(point.x, point.y, point.z, 5.0f);
         }
@@ -125,6 +119,7 @@ void Draw::DrawSamplePoint() {
 
 // Display 함수 (OpenGL 렌더링 루프)
 void Draw::Display() {
+    PROFILE_SCOPE("Draw::Display");
     // OpenGL 그리기 설정
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); // 화면과 깊이 버퍼 지우기
 
@@ -0,0 +1,225 @@
+/* Profiler.cpp
+ * Linked file Profiler.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * Profiler 구현: thread별 고정 크기 track + Chrome trace-event JSON writer
+ */
+
+#include "Profiler.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> Profiler::recording{false};
+
+namespace {
+
+struct ProfileEvent {
+    const char* name;
+    std::uint64_t startNs;
+    std::uint64_t durationNs;
+};
+
+// thread 하나의 event 배열. 소유 thread만 쓰고, count를 release로 올려 writer에 공개한다.
+struct ProfileTrack {
+    explicit ProfileTrack(std::uint32_t id) : thread(id), session(0), count(0), dropped(0),
+                                              events(new ProfileEvent[Profiler::kTrackCapacity]) {
+        name[0] = '\0';
+    }
+
+    std::uint32_t thread;
+    std::atomic<std::uint64_t> session; // 마지막으로 기록한 Start() 번호
+    std::atomic<std::size_t> count;
+    std::atomic<std::size_t> dropped;
+    std::unique_ptr<ProfileEvent[]> events;
+    char name[Profiler::kThreadNameSize]; // RegistryMutex()로 보호
+};
+
+// 모든 track (thread가 끝나도 export를 위해 남겨 둠)
+// detach된 thread가 종료 중에도 사용할 수 있으므로 해제하지 않음
+// 끝난 thread의 track은 FreeTracks()로 돌아가 다음 thread가 이어서 사용하므로
+// track 수는 동시에 기록한 thread 수를 넘지 않는다 (연결마다 thread를 만드는 SocketServer 등)
+std::mutex& RegistryMutex() {
+    static auto* mutex = new std::mutex();
+    return *mutex;
+}
+
+std::vector<std::unique_ptr<ProfileTrack>>& Registry() {
+    static auto* tracks = new std::vector<std::unique_ptr<ProfileTrack>>();
+    return *tracks;
+}
+
+// 소유 thread가 끝난 track (RegistryMutex()로 보호)
+std::vector<ProfileTrack*>& FreeTracks() {
+    static auto* tracks = new std::vector<ProfileTrack*>();
+    return *tracks;
+}
+
+std::atomic<std::uint64_t> currentSession{0};
+
+const std::chrono::steady_clock::time_point& Epoch() {
+    static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    return epoch;
+}
+
+// 호출한 thread의 track과 이름 (track은 처음 기록할 때 한 번 얻음)
+thread_local ProfileTrack* currentTrack = nullptr;
+thread_local bool trackReleased = false; // thread 종료 중 track을 이미 돌려준 경우
+thread_local char currentThreadName[Profiler::kThreadNameSize] = "";
+
+// thread가 끝날 때 track을 FreeTracks()로 돌려준다
+// 기록된 event는 track에 남아 있고, 다음 thread는 같은 session이면 그 뒤에 이어서 기록한다 (같은 tid로 보임)
+struct TrackLease {
+    ~TrackLease() {
+        if (!currentTrack) return;
+        std::lock_guard<std::mutex> lock(RegistryMutex());
+        FreeTracks().push_back(currentTrack);
+        currentTrack = nullptr;
+        trackReleased = true;
+    }
+};
+thread_local TrackLease trackLease;
+
+// 끝난 thread의 track을 재사용하고, 없으면 새로 만든다
+// thread 종료 중 (track을 돌려준 뒤) 기록하면 nullptr
+ProfileTrack* CurrentTrack() {
+    if (!currentTrack && !trackReleased) {
+        (void)&trackLease; // thread 종료 시 소멸자가 호출되도록 thread_local 생성
+        std::lock_guard<std::mutex> lock(RegistryMutex());
+        auto& freeTracks = FreeTracks();
+        if (!freeTracks.empty()) {
+            currentTrack = freeTracks.back();
+            freeTracks.pop_back();
+        } else {
+            auto& tracks = Registry();
+            tracks.push_back(std::make_unique<ProfileTrack>(static_cast<std::uint32_t>(tracks.size() + 1)));
+            currentTrack = tracks.back().get();
+        }
+        std::memcpy(currentTrack->name, currentThreadName, sizeof(currentThreadName));
+    }
+    return currentTrack;
+}
+
+// JSON 문자열로 출력 (따옴표, 역슬래시, 제어 문자 escape)
+void WriteJsonString(std::FILE* file, const char* text) {
+    std::fputc('"', file);
+    for (const char* p = text; *p; ++p) {
+        unsigned char c = static_cast<unsigned char>(*p);
+        if (c == '"' || c == '\\') {
+            std::fputc('\\', file);
+            std::fputc(c, file);
+        } else if (c < 0x20) {
+            std::fprintf(file, "\\u%04x", c);
+        } else {
+            std::fputc(c, file);
+        }
+    }
+    std::fputc('"', file);
+}
+
+} // namespace
+
+void Profiler::Start() {
+    Epoch();
+    // 각 track은 다음 기록 시 새 session 번호를 보고 스스로 비운다 (소유 thread만 count를 수정)
+    currentSession.fetch_add(1, std::memory_order_acq_rel);
+    recording.store(true, std::memory_order_release);
+}
+
+void Profiler::Stop() {
+    recording.store(false, std::memory_order_release);
+}
+
+std::uint64_t Profiler::Now() {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Epoch()).count());
+}
+
+void Profiler::Record(const char* name, std::uint64_t startNs, std::uint64_t endNs) {
+    ProfileTrack* current = CurrentTrack();
+    if (!current) return;
+    ProfileTrack& track = *current;
+    std::uint64_t session = currentSession.load(std::memory_order_acquire);
+    if (track.session.load(std::memory_order_relaxed) != session) {
+        track.count.store(0, std::memory_order_relaxed);
+        track.dropped.store(0, std::memory_order_relaxed);
+        track.session.store(session, std::memory_order_release);
+    }
+
+    std::size_t n = track.count.load(std::memory_order_relaxed);
+    if (n >= kTrackCapacity) {
+        track.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    track.events[n] = ProfileEvent{name, startNs, endNs - startNs};
+    track.count.store(n + 1, std::memory_order_release);
+}
+
+void Profiler::SetThreadName(const char* name) {
+    std::strncpy(currentThreadName, name ? name : "", kThreadNameSize - 1);
+    currentThreadName[kThreadNameSize - 1] = '\0';
+    // 기록한 적 없는 thread는 track을 만들지 않음 (track 생성 시 이름 복사)
+    if (currentTrack) {
+        std::lock_guard<std::mutex> lock(RegistryMutex());
+        std::memcpy(currentTrack->name, currentThreadName, sizeof(currentThreadName));
+    }
+}
+
+bool Profiler::WriteChromeTrace(const std::string& path) {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    const int pid = 1;
+    std::uint64_t session = currentSession.load(std::memory_order_acquire);
+    std::fprintf(file, "{\"traceEvents\":[\n");
+    std::fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,\"args\":{\"name\":\"TheNewDream\"}}", pid);
+
+    std::lock_guard<std::mutex> lock(RegistryMutex());
+    for (const auto& track : Registry()) {
+        char threadName[kThreadNameSize + 16];
+        if (track->name[0]) {
+            std::snprintf(threadName, sizeof(threadName), "%s", track->name);
+        } else {
+            std::snprintf(threadName, sizeof(threadName), "thread %u", track->thread);
+        }
+        std::fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":", pid,
+                     track->thread);
+        WriteJsonString(file, threadName);
+        std::fprintf(file, "}}");
+
+        // 이번 session에 기록한 track만 출력 (count까지는 소유 thread가 다 쓴 event)
+        if (track->session.load(std::memory_order_acquire) != session) continue;
+        std::size_t n = track->count.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < n; ++i) {
+            const ProfileEvent& event = track->events[i];
+            std::fprintf(file, ",\n{\"name\":");
+            WriteJsonString(file, event.name);
+            // ts/dur 단위는 microsecond
+            std::fprintf(file, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%u}",
+                         static_cast<double>(event.startNs) * 1e-3, static_cast<double>(event.durationNs) * 1e-3, pid,
+                         track->thread);
+        }
+    }
+
+    std::fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    bool ok = std::ferror(file) == 0;
+    return std::fclose(file) == 0 && ok;
+}
+
+std::size_t Profiler::DroppedCount() {
+    std::uint64_t session = currentSession.load(std::memory_order_acquire);
+    std::lock_guard<std::mutex> lock(RegistryMutex());
+    std::size_t dropped = 0;
+    for (const auto& track : Registry()) {
+        if (track->session.load(std::memory_order_acquire) == session) {
+            dropped += track->dropped.load(std::memory_order_relaxed);
+        }
+    }
+    return dropped;
+}
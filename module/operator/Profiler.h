@@ -0,0 +1,112 @@
+/* Profiler.h
+ * Linked file Profiler.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * Pipeline 단계별 구간 측정 (scoped probe) 과 Chrome trace-event JSON 출력
+ *
+ * - 기록: PROFILE_SCOPE("이름")이 scope 시작/끝 시각을 재서 호출한 thread의 track에 event 하나를 추가한다.
+ *   track은 thread마다 하나이고 고정 크기 배열이라 lock과 heap 할당이 없다 (가득 차면 버리고 개수만 셈).
+ *   끝난 thread의 track은 다음에 기록을 시작하는 thread가 재사용한다 (기록된 event는 유지).
+ * - 비용: 기록 중이 아니면 probe는 atomic load 하나, 기록 중이면 steady_clock 두 번과 배열 쓰기 하나.
+ *   PROFILE_ENABLED=0으로 빌드하면 probe 코드 자체가 생성되지 않는다.
+ * - 출력: WriteChromeTrace()가 {"traceEvents":[...]} 형식으로 저장한다.
+ *   chrome://tracing 또는 ui.perfetto.dev에서 열면 thread별 track으로 보인다.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// probe 컴파일 여부 (빌드 옵션으로 변경, 예: -DPROFILE_ENABLED=0)
+#ifndef PROFILE_ENABLED
+#define PROFILE_ENABLED 1
+#endif
+
+/**
+ * @brief Profiler 클래스.
+ *        직접 Record를 호출하기보다 PROFILE_SCOPE 매크로를 사용한다.
+ */
+class Profiler {
+public:
+    // thread 하나가 기록할 수 있는 최대 event 수
+    static constexpr std::size_t kTrackCapacity = 1 << 16;
+    // thread 이름 최대 길이 (넘치면 잘림)
+    static constexpr std::size_t kThreadNameSize = 32;
+
+    // 기록 시작 (이전에 기록된 event는 모두 버림)
+    static void Start();
+
+    // 기록 중지 (기록된 event는 WriteChromeTrace 전까지 유지)
+    static void Stop();
+
+    static bool IsRecording() { return recording.load(std::memory_order_relaxed); }
+
+    // 프로세스 기준 시각 (ns)
+    static std::uint64_t Now();
+
+    /**
+     * @brief 호출한 thread의 track에 완료된 구간 하나를 추가합니다.
+     *
+     * @param name 구간 이름 (문자열 literal처럼 프로그램 종료까지 유효해야 함).
+     * @param startNs 시작 시각 (Now()).
+     * @param endNs 끝 시각 (Now()).
+     */
+    static void Record(const char* name, std::uint64_t startNs, std::uint64_t endNs);
+
+    // 호출한 thread의 track 이름 (trace viewer에 표시)
+    static void SetThreadName(const char* name);
+
+    /**
+     * @brief 기록된 event를 Chrome trace-event JSON 파일로 저장합니다.
+     *        기록 중에도 호출할 수 있으며, 호출 시점까지 완료된 event만 저장한다.
+     *
+     * @param path 저장할 파일 경로.
+     * @return 저장 성공 여부.
+     */
+    static bool WriteChromeTrace(const std::string& path);
+
+    // track이 가득 차서 버려진 event 수
+    static std::size_t DroppedCount();
+
+private:
+    static std::atomic<bool> recording;
+};
+
+/**
+ * @brief scope에 들어올 때 시각을 재고, 나갈 때 구간을 기록한다.
+ *        기록 중이 아닐 때 시작된 scope는 아무것도 기록하지 않는다.
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* scopeName)
+        : name(Profiler::IsRecording() ? scopeName : nullptr), startNs(name ? Profiler::Now() : 0) {}
+
+    ~ProfileScope() {
+        if (name) Profiler::Record(name, startNs, Profiler::Now());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name;
+    std::uint64_t startNs;
+};
+
+#define PROFILE_CONCAT_INNER_(a, b) a##b
+#define PROFILE_CONCAT_(a, b) PROFILE_CONCAT_INNER_(a, b)
+
+#if PROFILE_ENABLED
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT_(profileScope_, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name) do { } while (0)
+#endif
+
+#endif // PROFILER_H
@@ -0,0 +1,568 @@
+/* SceneFile.cpp
+ * Linked file SceneFile.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * Binary scene writer (buffer 단위 checksum 계산) 와 mmap loader 구현
+ */
+
+#include "SceneFile.h"
+#include "AttributesManager.h"
+#include "Profiler.h"
+#include "Trace.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+constexpr std::uint64_t kChecksumPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t kChecksumPrime2 = 0xC2B2AE3D27D4EB4FULL;
+
+std::uint64_t AlignUp(std::uint64_t value) {
+    return (value + kSceneSectionAlignment - 1) / kSceneSectionAlignment * kSceneSectionAlignment;
+}
+
+// section table 뒤 payload가 시작하는 위치
+std::uint64_t PayloadStart(std::uint32_t sectionCount) {
+    return AlignUp(sizeof(SceneFileHeader) + static_cast<std::uint64_t>(sectionCount) * sizeof(SceneSectionEntry));
+}
+
+// 파일에 순서대로 쓰면서 payload checksum을 계산 (buffer가 가득 찰 때만 flush하므로 항상 8 byte 단위)
+class SceneWriter {
+public:
+    SceneWriter(std::FILE* output, std::uint64_t position)
+        : file(output), buffer(kBufferSize), used(0), filePosition(position), checksum(0), failed(false) {}
+
+    void Put(const void* data, std::size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        while (size > 0) {
+            std::size_t n = std::min(size, kBufferSize - used);
+            std::memcpy(buffer.data() + used, bytes, n);
+            used += n;
+            bytes += n;
+            size -= n;
+            filePosition += n;
+            if (used == kBufferSize) Drain();
+        }
+    }
+
+    // 다음 section 경계까지 0으로 채움
+    void Pad() {
+        static const unsigned char zeros[kSceneSectionAlignment] = {};
+        Put(zeros, AlignUp(filePosition) - filePosition);
+    }
+
+    // 남은 buffer 출력 (Pad() 뒤에 호출해야 8 byte 단위가 유지됨)
+    bool Finish() {
+        Drain();
+        return !failed;
+    }
+
+    std::uint64_t position() const { return filePosition; }
+    std::uint64_t payloadChecksum() const { return checksum; }
+
+private:
+    static constexpr std::size_t kBufferSize = 1 << 20;
+
+    std::FILE* file;
+    std::vector<unsigned char> buffer;
+    std::size_t used;
+    std::uint64_t filePosition;
+    std::uint64_t checksum;
+    bool failed;
+
+    void Drain() {
+        if (used == 0) return;
+        checksum = SceneFile::Checksum(buffer.data(), used, checksum);
+        if (std::fwrite(buffer.data(), 1, used, file) != used) failed = true;
+        used = 0;
+    }
+};
+
+template <typename T>
+void PutValue(SceneWriter& writer, T value) {
+    writer.Put(&value, sizeof(T));
+}
+
+struct SectionPlan {
+    SceneSectionId id;
+    std::uint32_t elementSize;
+    std::uint64_t count;
+};
+
+// section id별 원소 크기 (이 version이 모르는 id는 0)
+std::uint32_t ExpectedElementSize(std::uint32_t id) {
+    switch (static_cast<SceneSectionId>(id)) {
+    case SceneSectionId::SegmentControlOffset:
+    case SceneSectionId::SegmentSampleOffset:
+        return sizeof(std::uint64_t);
+    case SceneSectionId::NodeIndex:
+    case SceneSectionId::BearingNode:
+    case SceneSectionId::BearingDepth:
+    case SceneSectionId::SegmentBufferIndex:
+    case SceneSectionId::SegmentStartNode:
+    case SceneSectionId::SegmentEndNode:
+        return sizeof(std::int32_t);
+    case SceneSectionId::NodeX: case SceneSectionId::NodeY: case SceneSectionId::NodeZ:
+    case SceneSectionId::NodeR: case SceneSectionId::NodeTheta: case SceneSectionId::NodePhi:
+    case SceneSectionId::BearingPhi: case SceneSectionId::BearingTheta:
+    case SceneSectionId::BearingForceX: case SceneSectionId::BearingForceY: case SceneSectionId::BearingForceZ:
+    case SceneSectionId::SegmentLevelOfDetail: case SceneSectionId::SegmentAlpha:
+    case SceneSectionId::ControlX: case SceneSectionId::ControlY: case SceneSectionId::ControlZ:
+    case SceneSectionId::SampleX: case SceneSectionId::SampleY: case SceneSectionId::SampleZ:
+        return sizeof(float);
+    }
+    return 0;
+}
+
+// 매핑된 section 위치 (id로 조회)
+struct ResolvedSection {
+    const unsigned char* data = nullptr;
+    std::uint64_t count = 0;
+    bool found = false;
+};
+
+// 매핑된 SoA 점 배열의 [begin, end) 범위를 segment 점 배열로 복사
+ScenePointVector ReadPoints(const ScenePointArrays& points, std::uint64_t begin, std::uint64_t end) {
+    ScenePointVector result;
+    result.reserve(static_cast<std::size_t>(end - begin));
+    for (std::uint64_t k = begin; k < end; ++k) {
+        result.emplace_back(points.x[k], points.y[k], points.z[k]);
+    }
+    return result;
+}
+
+} // namespace
+
+std::uint64_t SceneFile::Checksum(const void* data, std::size_t size, std::uint64_t seed) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    std::uint64_t hash = seed;
+    for (std::size_t i = 0; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash ^= word * kChecksumPrime2;
+        hash = ((hash << 31) | (hash >> 33)) * kChecksumPrime1;
+    }
+    return hash;
+}
+
+bool SceneFile::Write(const AttributesManager& attributesManager, const std::string& path) {
+    std::shared_ptr<const AttributesSnapshot> snapshot = attributesManager.Snapshot();
+    return Write(*snapshot, path);
+}
+
+bool SceneFile::Write(const AttributesSnapshot& snapshot, const std::string& path) {
+    PROFILE_SCOPE("SceneFile::Write");
+
+    std::uint64_t controlCount = 0;
+    std::uint64_t sampleCount = 0;
+    for (const auto& chunk : snapshot.segmentChunks) {
+        for (const SegmentRecord& record : *chunk) {
+            controlCount += record.controlPoints.size();
+            sampleCount += record.sampledPoints.size();
+        }
+    }
+
+    const std::uint64_t nodes = snapshot.nodeCount;
+    const std::uint64_t bearings = snapshot.bearingCount;
+    const std::uint64_t segments = snapshot.segmentCount;
+    const std::uint32_t i32 = sizeof(std::int32_t);
+    const std::uint32_t f32 = sizeof(float);
+    const std::uint32_t u64 = sizeof(std::uint64_t);
+    const std::vector<SectionPlan> plan = {
+        {SceneSectionId::NodeIndex, i32, nodes},
+        {SceneSectionId::NodeX, f32, nodes},
+        {SceneSectionId::NodeY, f32, nodes},
+        {SceneSectionId::NodeZ, f32, nodes},
+        {SceneSectionId::NodeR, f32, nodes},
+        {SceneSectionId::NodeTheta, f32, nodes},
+        {SceneSectionId::NodePhi, f32, nodes},
+        {SceneSectionId::BearingNode, i32, bearings},
+        {SceneSectionId::BearingDepth, i32, bearings},
+        {SceneSectionId::BearingPhi, f32, bearings},
+        {SceneSectionId::BearingTheta, f32, bearings},
+        {SceneSectionId::BearingForceX, f32, bearings},
+        {SceneSectionId::BearingForceY, f32, bearings},
+        {SceneSectionId::BearingForceZ, f32, bearings},
+        {SceneSectionId::SegmentBufferIndex, i32, segments},
+        {SceneSectionId::SegmentStartNode, i32, segments},
+        {SceneSectionId::SegmentEndNode, i32, segments},
+        {SceneSectionId::SegmentLevelOfDetail, f32, segments},
+        {SceneSectionId::SegmentAlpha, f32, segments},
+        {SceneSectionId::SegmentControlOffset, u64, segments + 1},
+        {SceneSectionId::SegmentSampleOffset, u64, segments + 1},
+        {SceneSectionId::ControlX, f32, controlCount},
+        {SceneSectionId::ControlY, f32, controlCount},
+        {SceneSectionId::ControlZ, f32, controlCount},
+        {SceneSectionId::SampleX, f32, sampleCount},
+        {SceneSectionId::SampleY, f32, sampleCount},
+        {SceneSectionId::SampleZ, f32, sampleCount},
+    };
+
+    // section 위치 계산
+    SceneFileHeader header{};
+    std::memcpy(header.magic, kSceneFileMagic, sizeof(header.magic));
+    header.version = kSceneFileVersion;
+    header.headerSize = sizeof(SceneFileHeader);
+    header.sectionCount = static_cast<std::uint32_t>(plan.size());
+    header.byteOrderMark = kSceneByteOrderMark;
+    header.sceneVersion = snapshot.version;
+
+    std::vector<SceneSectionEntry> table;
+    std::uint64_t offset = PayloadStart(header.sectionCount);
+    for (const SectionPlan& section : plan) {
+        table.push_back(SceneSectionEntry{static_cast<std::uint32_t>(section.id), section.elementSize, offset,
+                                          section.count});
+        offset = AlignUp(offset + section.count * section.elementSize);
+    }
+    header.fileSize = offset;
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        TRACE_ERROR("SceneFile: unable to open %s for writing", path.c_str());
+        return false;
+    }
+
+    // header는 checksum을 계산한 뒤 다시 기록
+    std::fwrite(&header, sizeof(header), 1, file);
+    std::fwrite(table.data(), sizeof(SceneSectionEntry), table.size(), file);
+    static const unsigned char zeros[kSceneSectionAlignment] = {};
+    std::uint64_t tableEnd = sizeof(header) + table.size() * sizeof(SceneSectionEntry);
+    std::fwrite(zeros, 1, PayloadStart(header.sectionCount) - tableEnd, file);
+    SceneWriter writer(file, PayloadStart(header.sectionCount));
+
+    // Node: chunk의 SoA 배열을 그대로 기록
+    auto putNodeArray = [&](auto select) {
+        for (const auto& chunk : snapshot.nodeChunks) {
+            NodeSphericalView spherical = chunk->spherical();
+            NodeCartesianView cartesian = chunk->cartesian();
+            const auto* data = select(spherical, cartesian);
+            writer.Put(data, spherical.size * sizeof(*data));
+        }
+        writer.Pad();
+    };
+    putNodeArray([](const NodeSphericalView& s, const NodeCartesianView&) { return s.index; });
+    putNodeArray([](const NodeSphericalView&, const NodeCartesianView& c) { return c.x; });
+    putNodeArray([](const NodeSphericalView&, const NodeCartesianView& c) { return c.y; });
+    putNodeArray([](const NodeSphericalView&, const NodeCartesianView& c) { return c.z; });
+    putNodeArray([](const NodeSphericalView& s, const NodeCartesianView&) { return s.r; });
+    putNodeArray([](const NodeSphericalView& s, const NodeCartesianView&) { return s.theta; });
+    putNodeArray([](const NodeSphericalView& s, const NodeCartesianView&) { return s.phi; });
+
+    // Bearing: 필드별로 한 section씩
+    auto putBearingField = [&](auto select) {
+        for (const auto& chunk : snapshot.bearingChunks) {
+            for (const BearingVector& bearing : *chunk) PutValue(writer, select(bearing));
+        }
+        writer.Pad();
+    };
+    putBearingField([](const BearingVector& b) { return static_cast<std::int32_t>(b.getNodeIndex()); });
+    putBearingField([](const BearingVector& b) { return static_cast<std::int32_t>(b.getDepth()); });
+    putBearingField([](const BearingVector& b) { return b.getPhi(); });
+    putBearingField([](const BearingVector& b) { return b.getTheta(); });
+    putBearingField([](const BearingVector& b) { return b.getForce().Force.x; });
+    putBearingField([](const BearingVector& b) { return b.getForce().Force.y; });
+    putBearingField([](const BearingVector& b) { return b.getForce().Force.z; });
+
+    // Segment: 필드별 section, 점 배열은 segment 순서대로 이어 붙임
+    auto putSegmentField = [&](auto select) {
+        for (const auto& chunk : snapshot.segmentChunks) {
+            for (const SegmentRecord& record : *chunk) PutValue(writer, select(record));
+        }
+        writer.Pad();
+    };
+    putSegmentField([](const SegmentRecord& s) { return static_cast<std::int32_t>(s.data.LinerBufferIndex); });
+    putSegmentField([](const SegmentRecord& s) {
+        return static_cast<std::int32_t>(s.data.NodeStart.GetSphericalNodeVector().i_n);
+    });
+    putSegmentField([](const SegmentRecord& s) {
+        return static_cast<std::int32_t>(s.data.NodeEnd.GetSphericalNodeVector().i_n);
+    });
+    putSegmentField([](const SegmentRecord& s) { return s.data.LevelOfDetail; });
+    putSegmentField([](const SegmentRecord& s) { return s.data.alpha; });
+
+    auto putOffsets = [&](auto select) {
+        std::uint64_t running = 0;
+        PutValue(writer, running);
+        for (const auto& chunk : snapshot.segmentChunks) {
+            for (const SegmentRecord& record : *chunk) {
+                running += select(record).size();
+                PutValue(writer, running);
+            }
+        }
+        writer.Pad();
+    };
+    putOffsets([](const SegmentRecord& s) -> const std::vector<Vector3>& { return s.controlPoints; });
+    putOffsets([](const SegmentRecord& s) -> const std::vector<Vector3>& { return s.sampledPoints; });
+
+    auto putPoints = [&](auto points, float Vector3::*axis) {
+        for (const auto& chunk : snapshot.segmentChunks) {
+            for (const SegmentRecord& record : *chunk) {
+                for (const Vector3& point : points(record)) PutValue(writer, point.*axis);
+            }
+        }
+        writer.Pad();
+    };
+    auto control = [](const SegmentRecord& s) -> const std::vector<Vector3>& { return s.controlPoints; };
+    auto sampled = [](const SegmentRecord& s) -> const std::vector<Vector3>& { return s.sampledPoints; };
+    putPoints(control, &Vector3::x);
+    putPoints(control, &Vector3::y);
+    putPoints(control, &Vector3::z);
+    putPoints(sampled, &Vector3::x);
+    putPoints(sampled, &Vector3::y);
+    putPoints(sampled, &Vector3::z);
+
+    bool ok = writer.Finish() && writer.position() == header.fileSize;
+    header.payloadChecksum = writer.payloadChecksum();
+    ok = ok && std::fseek(file, 0, SEEK_SET) == 0 && std::fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok) TRACE_ERROR("SceneFile: failed to write %s", path.c_str());
+    return ok;
+}
+
+MappedScene::~MappedScene() {
+    Close();
+}
+
+MappedScene::MappedScene(MappedScene&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedScene& MappedScene::operator=(MappedScene&& other) noexcept {
+    if (this != &other) {
+        Close();
+        base = other.base;
+        mappedSize = other.mappedSize;
+        nodeArrays = other.nodeArrays;
+        bearingArrays = other.bearingArrays;
+        segmentArrays = other.segmentArrays;
+        controlArrays = other.controlArrays;
+        sampleArrays = other.sampleArrays;
+        other.base = nullptr;
+        other.mappedSize = 0;
+    }
+    return *this;
+}
+
+void MappedScene::Close() {
+    if (base) {
+        munmap(const_cast<unsigned char*>(base), mappedSize);
+    }
+    base = nullptr;
+    mappedSize = 0;
+    nodeArrays = SceneNodeArrays{};
+    bearingArrays = SceneBearingArrays{};
+    segmentArrays = SceneSegmentArrays{};
+    controlArrays = ScenePointArrays{};
+    sampleArrays = ScenePointArrays{};
+}
+
+bool MappedScene::Open(const std::string& path, bool verifyChecksum) {
+    PROFILE_SCOPE("MappedScene::Open");
+    Close();
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        TRACE_ERROR("SceneFile: unable to open %s", path.c_str());
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(SceneFileHeader)) {
+        TRACE_ERROR("SceneFile: %s is too small to be a scene file", path.c_str());
+        close(fd);
+        return false;
+    }
+    mappedSize = static_cast<std::size_t>(info.st_size);
+    void* mapped = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // mapping은 fd를 닫아도 유지됨
+    if (mapped == MAP_FAILED) {
+        TRACE_ERROR("SceneFile: mmap failed for %s", path.c_str());
+        mappedSize = 0;
+        return false;
+    }
+    base = static_cast<const unsigned char*>(mapped);
+
+    const SceneFileHeader& fileHeader = header();
+    if (std::memcmp(fileHeader.magic, kSceneFileMagic, sizeof(kSceneFileMagic)) != 0 ||
+        fileHeader.byteOrderMark != kSceneByteOrderMark || fileHeader.version != kSceneFileVersion ||
+        fileHeader.headerSize != sizeof(SceneFileHeader) || fileHeader.fileSize != mappedSize) {
+        TRACE_ERROR("SceneFile: %s has an unsupported header (version %u)", path.c_str(), fileHeader.version);
+        Close();
+        return false;
+    }
+    if (!ResolveSections()) {
+        TRACE_ERROR("SceneFile: %s has an invalid section table", path.c_str());
+        Close();
+        return false;
+    }
+    if (verifyChecksum) {
+        std::uint64_t start = PayloadStart(fileHeader.sectionCount);
+        if (SceneFile::Checksum(base + start, mappedSize - start) != fileHeader.payloadChecksum) {
+            TRACE_ERROR("SceneFile: checksum mismatch in %s", path.c_str());
+            Close();
+            return false;
+        }
+    }
+    return true;
+}
+
+// section table 검사 후 배열 포인터 설정 (값 자체는 offset 배열 외에는 읽지 않음)
+bool MappedScene::ResolveSections() {
+    const SceneFileHeader& fileHeader = header();
+    std::uint64_t payloadStart = PayloadStart(fileHeader.sectionCount);
+    if (payloadStart > mappedSize || mappedSize % sizeof(std::uint64_t) != 0) return false;
+
+    const std::uint32_t kMaxSectionId = static_cast<std::uint32_t>(SceneSectionId::SampleZ);
+    std::vector<ResolvedSection> sections(kMaxSectionId + 1);
+    const SceneSectionEntry* table = reinterpret_cast<const SceneSectionEntry*>(base + sizeof(SceneFileHeader));
+    for (std::uint32_t i = 0; i < fileHeader.sectionCount; ++i) {
+        const SceneSectionEntry& entry = table[i];
+        // offset > mappedSize를 먼저 거르므로 (mappedSize - offset)은 음수가 되지 않음
+        if (entry.offset < payloadStart || entry.offset > mappedSize || entry.offset % kSceneSectionAlignment != 0 ||
+            entry.elementSize == 0 || entry.count > (mappedSize - entry.offset) / entry.elementSize) {
+            return false;
+        }
+        std::uint32_t expectedSize = ExpectedElementSize(entry.id);
+        if (expectedSize == 0) continue; // 이후 version에서 추가된 section
+        if (entry.elementSize != expectedSize) return false;
+        ResolvedSection& section = sections[entry.id];
+        section.data = base + entry.offset;
+        section.count = entry.count;
+        section.found = true;
+    }
+
+    // 필수 section이 모두 있고 같은 그룹의 원소 수가 같은지 확인
+    auto require = [&](SceneSectionId id, std::uint64_t count) -> const void* {
+        const ResolvedSection& section = sections[static_cast<std::uint32_t>(id)];
+        return section.found && section.count == count ? section.data : nullptr;
+    };
+    const ResolvedSection& nodeIndex = sections[static_cast<std::uint32_t>(SceneSectionId::NodeIndex)];
+    const ResolvedSection& bearingNode = sections[static_cast<std::uint32_t>(SceneSectionId::BearingNode)];
+    const ResolvedSection& bufferIndex = sections[static_cast<std::uint32_t>(SceneSectionId::SegmentBufferIndex)];
+    const ResolvedSection& controlX = sections[static_cast<std::uint32_t>(SceneSectionId::ControlX)];
+    const ResolvedSection& sampleX = sections[static_cast<std::uint32_t>(SceneSectionId::SampleX)];
+    if (!nodeIndex.found || !bearingNode.found || !bufferIndex.found || !controlX.found || !sampleX.found) {
+        return false;
+    }
+
+    const std::uint64_t nodes = nodeIndex.count;
+    nodeArrays.index = static_cast<const std::int32_t*>(require(SceneSectionId::NodeIndex, nodes));
+    nodeArrays.x = static_cast<const float*>(require(SceneSectionId::NodeX, nodes));
+    nodeArrays.y = static_cast<const float*>(require(SceneSectionId::NodeY, nodes));
+    nodeArrays.z = static_cast<const float*>(require(SceneSectionId::NodeZ, nodes));
+    nodeArrays.r = static_cast<const float*>(require(SceneSectionId::NodeR, nodes));
+    nodeArrays.theta = static_cast<const float*>(require(SceneSectionId::NodeTheta, nodes));
+    nodeArrays.phi = static_cast<const float*>(require(SceneSectionId::NodePhi, nodes));
+    nodeArrays.count = nodes;
+
+    const std::uint64_t bearings = bearingNode.count;
+    bearingArrays.nodeIndex = static_cast<const std::int32_t*>(require(SceneSectionId::BearingNode, bearings));
+    bearingArrays.depth = static_cast<const std::int32_t*>(require(SceneSectionId::BearingDepth, bearings));
+    bearingArrays.phi = static_cast<const float*>(require(SceneSectionId::BearingPhi, bearings));
+    bearingArrays.theta = static_cast<const float*>(require(SceneSectionId::BearingTheta, bearings));
+    bearingArrays.forceX = static_cast<const float*>(require(SceneSectionId::BearingForceX, bearings));
+    bearingArrays.forceY = static_cast<const float*>(require(SceneSectionId::BearingForceY, bearings));
+    bearingArrays.forceZ = static_cast<const float*>(require(SceneSectionId::BearingForceZ, bearings));
+    bearingArrays.count = bearings;
+
+    const std::uint64_t segments = bufferIndex.count;
+    segmentArrays.bufferIndex = static_cast<const std::int32_t*>(require(SceneSectionId::SegmentBufferIndex, segments));
+    segmentArrays.startNode = static_cast<const std::int32_t*>(require(SceneSectionId::SegmentStartNode, segments));
+    segmentArrays.endNode = static_cast<const std::int32_t*>(require(SceneSectionId::SegmentEndNode, segments));
+    segmentArrays.levelOfDetail = static_cast<const float*>(require(SceneSectionId::SegmentLevelOfDetail, segments));
+    segmentArrays.alpha = static_cast<const float*>(require(SceneSectionId::SegmentAlpha, segments));
+    segmentArrays.controlOffset =
+        static_cast<const std::uint64_t*>(require(SceneSectionId::SegmentControlOffset, segments + 1));
+    segmentArrays.sampleOffset =
+        static_cast<const std::uint64_t*>(require(SceneSectionId::SegmentSampleOffset, segments + 1));
+    segmentArrays.count = segments;
+
+    controlArrays.x = static_cast<const float*>(require(SceneSectionId::ControlX, controlX.count));
+    controlArrays.y = static_cast<const float*>(require(SceneSectionId::ControlY, controlX.count));
+    controlArrays.z = static_cast<const float*>(require(SceneSectionId::ControlZ, controlX.count));
+    controlArrays.count = controlX.count;
+    sampleArrays.x = static_cast<const float*>(require(SceneSectionId::SampleX, sampleX.count));
+    sampleArrays.y = static_cast<const float*>(require(SceneSectionId::SampleY, sampleX.count));
+    sampleArrays.z = static_cast<const float*>(require(SceneSectionId::SampleZ, sampleX.count));
+    sampleArrays.count = sampleX.count;
+
+    const void* required[] = {
+        nodeArrays.x, nodeArrays.y, nodeArrays.z, nodeArrays.r, nodeArrays.theta, nodeArrays.phi,
+        bearingArrays.depth, bearingArrays.phi, bearingArrays.theta,
+        bearingArrays.forceX, bearingArrays.forceY, bearingArrays.forceZ,
+        segmentArrays.startNode, segmentArrays.endNode, segmentArrays.levelOfDetail, segmentArrays.alpha,
+        segmentArrays.controlOffset, segmentArrays.sampleOffset,
+        controlArrays.y, controlArrays.z, sampleArrays.y, sampleArrays.z,
+    };
+    for (const void* pointer : required) {
+        if (!pointer) return false;
+    }
+
+    // segment i의 점 범위가 배열 안에 있도록 offset 배열 검사
+    auto validOffsets = [segments](const std::uint64_t* offsets, std::uint64_t total) {
+        if (offsets[0] != 0 || offsets[segments] != total) return false;
+        for (std::uint64_t i = 0; i < segments; ++i) {
+            if (offsets[i] > offsets[i + 1]) return false;
+        }
+        return true;
+    };
+    return validOffsets(segmentArrays.controlOffset, controlArrays.count) &&
+           validOffsets(segmentArrays.sampleOffset, sampleArrays.count);
+}
+
+std::size_t MappedScene::ImportInto(AttributesManager& attributesManager) const {
+    PROFILE_SCOPE("MappedScene::ImportInto");
+    if (!base) return 0;
+
+    const bool reuseSamples = attributesManager.getNodeVectors().size() == 0 &&
+                              attributesManager.getBearingVectors().empty();
+    attributesManager.BeginTransaction(nodeArrays.count, bearingArrays.count, segmentArrays.count);
+    // 항목 하나의 추가는 probe 비용보다 짧으므로 section 단위로만 측정
+    {
+        PROFILE_SCOPE("MappedScene::ImportInto (nodes)");
+        for (std::size_t i = 0; i < nodeArrays.count; ++i) {
+            // 저장된 두 형태를 그대로 사용 (좌표 변환 없음)
+            int index = nodeArrays.index[i];
+            attributesManager.CreateNodeVector(
+                NodeVector(SphericalNodeVector(index, nodeArrays.r[i], nodeArrays.theta[i], nodeArrays.phi[i]),
+                           CartesianNodeVector(index, nodeArrays.x[i], nodeArrays.y[i], nodeArrays.z[i])));
+        }
+    }
+    {
+        PROFILE_SCOPE("MappedScene::ImportInto (bearings)");
+        for (std::size_t i = 0; i < bearingArrays.count; ++i) {
+            attributesManager.CreateBearingVector(
+                BearingVector(bearingArrays.nodeIndex[i], bearingArrays.depth[i], bearingArrays.phi[i],
+                              bearingArrays.theta[i], bearingArrays.forceX[i], bearingArrays.forceY[i],
+                              bearingArrays.forceZ[i]));
+        }
+    }
+    // 빈 manager에 읽으면 저장된 control point / sample을 그대로 사용 (다시 샘플링하지 않으므로 매핑된 page만 읽음)
+    // 이미 node/bearing이 있으면 같은 index의 기존 값이 양 끝이 될 수 있으므로 commit에서 다시 샘플링
+    {
+        PROFILE_SCOPE("MappedScene::ImportInto (segments)");
+        for (std::size_t i = 0; i < segmentArrays.count; ++i) {
+            if (!reuseSamples) {
+                // 샘플링하지 않고 추가 (commit의 병렬 재샘플링에서 한 번만 샘플링)
+                attributesManager.CreateLinerSegment(segmentArrays.startNode[i], segmentArrays.endNode[i],
+                                                     segmentArrays.levelOfDetail[i], segmentArrays.alpha[i]);
+                continue;
+            }
+            attributesManager.CreateSampledLinerSegment(LinerSegment(
+                segmentArrays.startNode[i], segmentArrays.endNode[i], attributesManager,
+                segmentArrays.levelOfDetail[i], segmentArrays.alpha[i],
+                ReadPoints(controlArrays, segmentArrays.controlOffset[i], segmentArrays.controlOffset[i + 1]),
+                ReadPoints(sampleArrays, segmentArrays.sampleOffset[i], segmentArrays.sampleOffset[i + 1])));
+        }
+    }
+    attributesManager.CommitTransaction();
+    return segmentArrays.count;
+}
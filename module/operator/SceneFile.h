@@ -0,0 +1,192 @@
+/* SceneFile.h
+ * Linked file SceneFile.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * Scene을 binary 파일로 저장하고, mmap으로 열어 배열을 복사 없이 그대로 사용
+ *
+ * File layout (little-endian, version 1)
+ * [SceneFileHeader 64 bytes][SceneSectionEntry × sectionCount][section payload ...]
+ * - 각 section은 한 종류의 값을 담은 SoA 배열이며 kSceneSectionAlignment 경계에서 시작한다.
+ *   (node x 배열, bearing phi 배열, sample x 배열 ...)
+ * - segment의 control point / sample은 전체 scene에 대해 이어 붙인 배열이고,
+ *   segment i의 점은 offset[i] ~ offset[i + 1] 범위이다 (offset 배열 길이는 segment 수 + 1).
+ * - payloadChecksum은 section table 뒤의 모든 byte (padding 포함)에 대한 64-bit 값이다.
+ * - loader는 모르는 section id를 무시하므로 section 추가는 version을 올리지 않아도 된다.
+ */
+
+#ifndef SCENEFILE_H
+#define SCENEFILE_H
+
+#include "AttributesSnapshot.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class AttributesManager;
+
+constexpr char kSceneFileMagic[8] = {'N', 'B', 'V', 'S', 'C', 'E', 'N', 'E'};
+constexpr std::uint32_t kSceneFileVersion = 1;
+constexpr std::uint32_t kSceneByteOrderMark = 0x01020304;
+constexpr std::size_t kSceneSectionAlignment = 64;
+
+// section 종류 (값은 파일 형식의 일부이므로 바꾸지 않음)
+enum class SceneSectionId : std::uint32_t {
+    NodeIndex = 1,          // int32
+    NodeX, NodeY, NodeZ,    // float
+    NodeR, NodeTheta, NodePhi,
+    BearingNode = 16,       // int32
+    BearingDepth,           // int32
+    BearingPhi, BearingTheta,
+    BearingForceX, BearingForceY, BearingForceZ,
+    SegmentBufferIndex = 32, // int32 (LinerBufferIndex)
+    SegmentStartNode,        // int32
+    SegmentEndNode,          // int32
+    SegmentLevelOfDetail,    // float
+    SegmentAlpha,            // float
+    SegmentControlOffset,    // uint64, segment 수 + 1
+    SegmentSampleOffset,     // uint64, segment 수 + 1
+    ControlX = 48, ControlY, ControlZ,
+    SampleX = 64, SampleY, SampleZ
+};
+
+struct SceneFileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t headerSize;
+    std::uint32_t sectionCount;
+    std::uint32_t byteOrderMark;
+    std::uint64_t fileSize;
+    std::uint64_t payloadChecksum;
+    std::uint64_t sceneVersion; // 저장한 snapshot의 version
+    std::uint64_t reserved[2];
+};
+static_assert(sizeof(SceneFileHeader) == 64, "SceneFileHeader must stay 64 bytes");
+
+struct SceneSectionEntry {
+    std::uint32_t id;          // SceneSectionId
+    std::uint32_t elementSize; // 원소 하나의 byte 수
+    std::uint64_t offset;      // 파일 시작 기준
+    std::uint64_t count;       // 원소 수
+};
+static_assert(sizeof(SceneSectionEntry) == 24, "SceneSectionEntry must stay 24 bytes");
+
+// 매핑된 파일 안의 배열 view (MappedScene이 열려 있는 동안 유효)
+struct SceneNodeArrays {
+    const std::int32_t* index;
+    const float* x;
+    const float* y;
+    const float* z;
+    const float* r;
+    const float* theta;
+    const float* phi;
+    std::size_t count;
+};
+
+struct SceneBearingArrays {
+    const std::int32_t* nodeIndex;
+    const std::int32_t* depth;
+    const float* phi;
+    const float* theta;
+    const float* forceX;
+    const float* forceY;
+    const float* forceZ;
+    std::size_t count;
+};
+
+struct SceneSegmentArrays {
+    const std::int32_t* bufferIndex;
+    const std::int32_t* startNode;
+    const std::int32_t* endNode;
+    const float* levelOfDetail;
+    const float* alpha;
+    const std::uint64_t* controlOffset; // count + 1개
+    const std::uint64_t* sampleOffset;  // count + 1개
+    std::size_t count;
+};
+
+struct ScenePointArrays {
+    const float* x;
+    const float* y;
+    const float* z;
+    std::size_t count;
+};
+
+/**
+ * @brief Scene binary 파일 writer.
+ */
+class SceneFile {
+public:
+    /**
+     * @brief snapshot을 binary scene 파일로 저장합니다.
+     *
+     * @param snapshot 저장할 snapshot (writer와 동시에 호출 가능).
+     * @param path 저장할 파일 경로.
+     * @return 저장 성공 여부.
+     */
+    static bool Write(const AttributesSnapshot& snapshot, const std::string& path);
+
+    // 마지막으로 publish된 snapshot 저장
+    static bool Write(const AttributesManager& attributesManager, const std::string& path);
+
+    // payload checksum (size는 8의 배수)
+    static std::uint64_t Checksum(const void* data, std::size_t size, std::uint64_t seed = 0);
+};
+
+/**
+ * @brief mmap으로 연 scene 파일.
+ *        Open은 header와 section table만 검사하며 배열은 처음 읽을 때 page 단위로 올라온다.
+ *        반환하는 배열 포인터는 Close()나 소멸 전까지 유효하다.
+ */
+class MappedScene {
+public:
+    MappedScene() = default;
+    ~MappedScene();
+    MappedScene(const MappedScene&) = delete;
+    MappedScene& operator=(const MappedScene&) = delete;
+    MappedScene(MappedScene&& other) noexcept;
+    MappedScene& operator=(MappedScene&& other) noexcept;
+
+    /**
+     * @brief 파일을 읽기 전용으로 매핑합니다.
+     *
+     * @param path scene 파일 경로.
+     * @param verifyChecksum true이면 payload 전체를 읽어 checksum을 확인 (모든 page를 읽음).
+     * @return 성공 여부 (실패하면 닫힌 상태).
+     */
+    bool Open(const std::string& path, bool verifyChecksum = false);
+    void Close();
+    bool isOpen() const { return base != nullptr; }
+
+    const SceneFileHeader& header() const { return *reinterpret_cast<const SceneFileHeader*>(base); }
+
+    SceneNodeArrays nodes() const { return nodeArrays; }
+    SceneBearingArrays bearings() const { return bearingArrays; }
+    SceneSegmentArrays segments() const { return segmentArrays; }
+    ScenePointArrays controlPoints() const { return controlArrays; }
+    ScenePointArrays sampledPoints() const { return sampleArrays; }
+
+    /**
+     * @brief 매핑된 scene을 AttributesManager에 추가합니다 (하나의 transaction).
+     *        segment는 manager topology에 연결된다. manager가 비어 있으면 저장된 control point / sample을
+     *        그대로 사용하고 (다시 샘플링하지 않음), node나 bearing이 이미 있으면 commit 시 다시 샘플링한다.
+     *
+     * @return 추가한 segment 수.
+     */
+    std::size_t ImportInto(AttributesManager& attributesManager) const;
+
+private:
+    const unsigned char* base = nullptr;
+    std::size_t mappedSize = 0;
+    SceneNodeArrays nodeArrays{};
+    SceneBearingArrays bearingArrays{};
+    SceneSegmentArrays segmentArrays{};
+    ScenePointArrays controlArrays{};
+    ScenePointArrays sampleArrays{};
+
+    bool ResolveSections();
+};
+
+#endif // SCENEFILE_H
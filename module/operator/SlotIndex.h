@@ -0,0 +1,163 @@
+/* SlotIndex.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * Generational slot map index: stable handle <-> dense array position
+ *
+ * 실제 데이터는 호출자가 연속 배열(dense array)에 저장하고, SlotIndex는 handle과
+ * dense 위치 사이의 매핑만 관리한다. 삭제는 swap-and-pop 방식으로, 마지막 원소를
+ * 삭제 위치로 옮기므로 dense 배열은 항상 빈칸 없이 유지된다.
+ * 삭제된 slot은 generation을 올린 뒤 재사용하므로, 오래된 handle은 Find에서 npos가 된다.
+ * Insert / Find / Erase 모두 O(1).
+ */
+
+#ifndef SLOTINDEX_H
+#define SLOTINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * @brief 종류(Tag)별로 구분되는 stable handle.
+ */
+template <typename Tag>
+struct Handle {
+    static constexpr std::uint32_t kInvalidSlot = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t slot = kInvalidSlot;
+    std::uint32_t generation = 0;
+
+    bool IsValid() const { return slot != kInvalidSlot; }
+    bool operator==(const Handle& other) const { return slot == other.slot && generation == other.generation; }
+    bool operator!=(const Handle& other) const { return !(*this == other); }
+};
+
+struct NodeHandleTag;
+struct BearingHandleTag;
+struct SegmentHandleTag;
+
+using NodeHandle = Handle<NodeHandleTag>;
+using BearingHandle = Handle<BearingHandleTag>;
+using SegmentHandle = Handle<SegmentHandleTag>;
+
+/**
+ * @brief 연속 배열 일부에 대한 읽기 전용 view (C++17에 std::span이 없으므로 최소 구현).
+ *        원본 배열이 수정되기 전까지만 유효하다.
+ */
+template <typename T>
+class ConstSpan {
+public:
+    ConstSpan() : first(nullptr), count(0) {}
+    ConstSpan(const T* data, std::size_t size) : first(data), count(size) {}
+
+    const T* begin() const { return first; }
+    const T* end() const { return first + count; }
+    const T* data() const { return first; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T& operator[](std::size_t i) const { return first[i]; }
+    const T& front() const { return first[0]; }
+
+private:
+    const T* first;
+    std::size_t count;
+};
+
+/**
+ * @brief SlotIndex 클래스.
+ *        dense 배열과 함께 사용하며, 호출 순서는 다음과 같다.
+ *        - 추가: dense 배열 끝에 원소를 추가하고 Insert() 호출
+ *        - 삭제: pos = Erase(handle) 후, pos != last 이면 dense[pos] = dense[last], 그 뒤 pop_back
+ */
+template <typename Tag>
+class SlotIndex {
+public:
+    using HandleType = Handle<Tag>;
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    SlotIndex() : freeHead(kNoFreeSlot) {}
+
+    std::size_t size() const { return denseToSlot.size(); }
+    bool empty() const { return denseToSlot.empty(); }
+
+    void reserve(std::size_t n) {
+        slots.reserve(n);
+        denseToSlot.reserve(n);
+    }
+
+    void clear() {
+        slots.clear();
+        denseToSlot.clear();
+        freeHead = kNoFreeSlot;
+    }
+
+    // dense 배열 끝(위치 size())에 추가된 원소의 handle 발급
+    HandleType Insert() {
+        std::uint32_t slot;
+        if (freeHead != kNoFreeSlot) {
+            slot = freeHead;
+            freeHead = slots[slot].position; // free list 다음 slot
+        } else {
+            slot = static_cast<std::uint32_t>(slots.size());
+            slots.push_back(Slot{0, 0});
+        }
+        slots[slot].position = static_cast<std::uint32_t>(denseToSlot.size());
+        denseToSlot.push_back(slot);
+        return HandleType{slot, slots[slot].generation};
+    }
+
+    // handle의 dense 위치 (삭제되었거나 잘못된 handle이면 npos)
+    std::size_t Find(HandleType handle) const {
+        if (!Contains(handle)) return npos;
+        return slots[handle.slot].position;
+    }
+
+    bool Contains(HandleType handle) const {
+        // 비어 있는 slot의 generation은 아직 발급되지 않은 값이므로 generation 비교만으로 충분
+        return handle.slot < slots.size() && slots[handle.slot].generation == handle.generation;
+    }
+
+    // dense 위치의 handle
+    HandleType HandleAt(std::size_t position) const {
+        std::uint32_t slot = denseToSlot[position];
+        return HandleType{slot, slots[slot].generation};
+    }
+
+    // handle 삭제. 반환값은 삭제된 원소의 dense 위치 (호출자가 마지막 원소를 이 위치로 옮겨야 함)
+    std::size_t Erase(HandleType handle) {
+        if (!Contains(handle)) return npos;
+        std::uint32_t position = slots[handle.slot].position;
+        std::uint32_t last = static_cast<std::uint32_t>(denseToSlot.size() - 1);
+
+        // 마지막 원소의 slot이 삭제 위치를 가리키도록 변경
+        std::uint32_t movedSlot = denseToSlot[last];
+        denseToSlot[position] = movedSlot;
+        slots[movedSlot].position = position;
+        denseToSlot.pop_back();
+
+        // 삭제된 slot은 generation을 올려 free list에 추가
+        Slot& freed = slots[handle.slot];
+        ++freed.generation;
+        freed.position = freeHead;
+        freeHead = handle.slot;
+        return position;
+    }
+
+private:
+    static constexpr std::uint32_t kNoFreeSlot = std::numeric_limits<std::uint32_t>::max();
+
+    struct Slot {
+        std::uint32_t position;   // 사용 중: dense 위치, 비어 있음: free list 다음 slot
+        std::uint32_t generation; // 삭제될 때마다 증가
+    };
+
+    std::vector<Slot> slots;
+    std::vector<std::uint32_t> denseToSlot;
+    std::uint32_t freeHead;
+};
+
+#endif // SLOTINDEX_H
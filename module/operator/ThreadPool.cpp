@@ -0,0 +1,159 @@
+/* ThreadPool.cpp
+ * Linked file ThreadPool.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * Work-stealing thread pool 구현
+ */
+
+#include "ThreadPool.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+
+// 생성자: worker 생성
+ThreadPool::ThreadPool(std::size_t threadCount)
+    : currentTask(nullptr), generation(0), activeWorkers(0), stopping(false) {
+    if (threadCount == 0) {
+        threadCount = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+// 소멸자: 모든 worker 종료 대기
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    startCondition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+// 프로세스 공유 pool
+ThreadPool& ThreadPool::Shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+// 자기 queue의 앞쪽에서 작업 꺼내기
+bool ThreadPool::PopLocal(std::size_t self, std::size_t& item) {
+    WorkerQueue& queue = *queues[self];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.items.empty()) return false;
+    item = queue.items.front();
+    queue.items.pop_front();
+    return true;
+}
+
+// 다른 worker queue의 뒤쪽(비용이 작은 작업)에서 훔쳐 오기
+bool ThreadPool::Steal(std::size_t self, std::size_t& item) {
+    const std::size_t count = queues.size();
+    for (std::size_t offset = 1; offset < count; ++offset) {
+        WorkerQueue& victim = *queues[(self + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.items.empty()) {
+            item = victim.items.back();
+            victim.items.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+// worker 실행 루프
+void ThreadPool::WorkerLoop(std::size_t self) {
+    char name[Profiler::kThreadNameSize];
+    std::snprintf(name, sizeof(name), "pool worker %zu", self);
+    Profiler::SetThreadName(name);
+
+    std::size_t seenGeneration = 0;
+    while (true) {
+        const std::function<void(std::size_t)>* task;
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            startCondition.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) return;
+            seenGeneration = generation;
+            task = currentTask;
+        }
+
+        // 모든 queue가 비면 batch 종료 (작업은 batch 도중 추가되지 않음)
+        std::size_t item;
+        while (PopLocal(self, item) || Steal(self, item)) {
+            try {
+                (*task)(item);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                if (!firstError) firstError = std::current_exception();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            if (--activeWorkers == 0) {
+                doneCondition.notify_all();
+            }
+        }
+    }
+}
+
+// batch 실행
+void ThreadPool::Run(const TaskQueues& taskQueues, const std::function<void(std::size_t)>& task) {
+    std::lock_guard<std::mutex> batchLock(batchMutex);
+
+    bool hasWork = false;
+    for (std::size_t q = 0; q < taskQueues.size(); ++q) {
+        WorkerQueue& queue = *queues[q % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.items.insert(queue.items.end(), taskQueues[q].begin(), taskQueues[q].end());
+        hasWork = hasWork || !taskQueues[q].empty();
+    }
+    if (!hasWork) return;
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(stateMutex);
+        currentTask = &task;
+        firstError = nullptr;
+        activeWorkers = workers.size();
+        ++generation;
+        startCondition.notify_all();
+        doneCondition.wait(lock, [&] { return activeWorkers == 0; });
+        currentTask = nullptr;
+        error = firstError;
+        firstError = nullptr;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// LPT (Longest Processing Time first) 분배
+ThreadPool::TaskQueues ThreadPool::PartitionByCost(const std::vector<double>& costs, std::size_t queueCount) {
+    if (queueCount == 0) queueCount = 1;
+    std::vector<std::size_t> order(costs.size());
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::size_t a, std::size_t b) { return costs[a] > costs[b]; });
+
+    TaskQueues result(queueCount);
+    std::vector<double> load(queueCount, 0.0);
+    for (std::size_t item : order) {
+        // 누적 비용이 가장 작은 queue (같으면 앞쪽 queue)
+        std::size_t target = static_cast<std::size_t>(std::min_element(load.begin(), load.end()) - load.begin());
+        result[target].push_back(item);
+        load[target] += costs[item];
+    }
+    return result;
+}
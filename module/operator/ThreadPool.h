@@ -0,0 +1,99 @@
+/* ThreadPool.h
+ * Linked file ThreadPool.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * Work-stealing thread pool for bulk attribute work (segment resampling 등)
+ *
+ * 작업은 index(0 ~ taskCount-1)로 표현하며, 호출자가 worker별 초기 queue를 정해 준다.
+ * 각 worker는 자기 queue의 앞쪽부터 꺼내고, 비면 다른 worker queue의 뒤쪽에서 훔쳐 온다.
+ * 작업이 서로 다른 데이터만 수정하면 결과는 실행 순서와 무관하게 결정적이다.
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief ThreadPool 클래스.
+ *        Run 호출 한 번이 하나의 batch이며, 모든 작업이 끝날 때까지 반환하지 않는다.
+ */
+class ThreadPool {
+public:
+    using TaskQueues = std::vector<std::vector<std::size_t>>;
+
+    /**
+     * @brief threadCount개의 worker를 생성합니다.
+     *
+     * @param threadCount worker 수 (0이면 std::thread::hardware_concurrency()).
+     */
+    explicit ThreadPool(std::size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // worker 수
+    std::size_t size() const { return workers.size(); }
+
+    /**
+     * @brief queues[w]를 worker w의 초기 queue로 하여 모든 작업을 실행합니다.
+     *        queues.size()가 worker 수보다 크면 남는 queue는 앞쪽 worker에 이어 붙인다.
+     *        작업이 예외를 던지면 나머지 작업을 끝낸 뒤 첫 번째 예외를 다시 던진다.
+     *        작업 안에서 같은 pool의 Run을 호출하면 안 된다.
+     *
+     * @param queues worker별 작업 index 목록.
+     * @param task 작업 index를 받아 실행하는 함수.
+     */
+    void Run(const TaskQueues& queues, const std::function<void(std::size_t)>& task);
+
+    /**
+     * @brief 비용이 큰 작업부터 누적 비용이 가장 작은 queue에 배정합니다 (LPT).
+     *        비용이 같으면 index 순서를 따르므로 결과는 항상 같다.
+     *
+     * @param costs 작업별 비용.
+     * @param queueCount queue 수.
+     * @return TaskQueues queue별 작업 index 목록 (비용 내림차순).
+     */
+    static TaskQueues PartitionByCost(const std::vector<double>& costs, std::size_t queueCount);
+
+    // 프로세스 전체에서 공유하는 pool (처음 호출 시 생성)
+    static ThreadPool& Shared();
+
+private:
+    // worker별 작업 queue
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::size_t> items;
+    };
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+
+    std::mutex batchMutex;     // Run 직렬화
+    std::mutex stateMutex;     // 아래 상태 보호
+    std::condition_variable startCondition;
+    std::condition_variable doneCondition;
+    const std::function<void(std::size_t)>* currentTask;
+    std::size_t generation;    // batch 번호 (worker 깨우기용)
+    std::size_t activeWorkers; // 현재 batch를 처리 중인 worker 수
+    std::exception_ptr firstError;
+    bool stopping;
+
+    void WorkerLoop(std::size_t self);
+    bool PopLocal(std::size_t self, std::size_t& item);
+    bool Steal(std::size_t self, std::size_t& item);
+};
+
+#endif // THREADPOOL_H
@@ -0,0 +1,171 @@
+/* Trace.cpp
+ * Linked file Trace.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * Tracing 구현: bounded MPSC ring buffer (D. Vyukov 방식) + 비동기 sink thread
+ */
+
+#include "Trace.h"
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+namespace {
+
+struct TraceRecord {
+    std::uint64_t timestampNs; // sink 생성 시점 기준
+    int level;
+    std::uint32_t thread;
+    char message[Trace::kMessageSize];
+};
+
+// slot의 sequence로 소유권을 표시: pos이면 producer가 쓸 수 있고, pos + 1이면 consumer가 읽을 수 있음
+struct alignas(64) TraceSlot {
+    std::atomic<std::size_t> sequence;
+    TraceRecord record;
+};
+
+const char* LevelName(int level) {
+    switch (level) {
+    case TRACE_LEVEL_ERROR: return "ERROR";
+    case TRACE_LEVEL_WARN: return "WARN";
+    case TRACE_LEVEL_INFO: return "INFO";
+    case TRACE_LEVEL_DEBUG: return "DEBUG";
+    default: return "-";
+    }
+}
+
+// thread별 짧은 번호 (출력용)
+std::uint32_t CurrentThreadNumber() {
+    static std::atomic<std::uint32_t> next{1};
+    thread_local std::uint32_t number = next.fetch_add(1, std::memory_order_relaxed);
+    return number;
+}
+
+class TraceSink {
+public:
+    TraceSink()
+        : slots(new TraceSlot[Trace::kRingCapacity]), enqueuePos(0), dequeuePos(0), dropped(0),
+          output(stderr), start(std::chrono::steady_clock::now()) {
+        for (std::size_t i = 0; i < Trace::kRingCapacity; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        std::thread(&TraceSink::Run, this).detach(); // 프로세스 종료 시 atexit에서 Flush
+    }
+
+    // producer: slot 하나를 예약해 기록 (가득 차면 false)
+    bool Push(int level, const char* format, va_list args) {
+        std::size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        TraceSlot* slot;
+        while (true) {
+            slot = &slots[pos & kMask];
+            std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        TraceRecord& record = slot->record;
+        record.timestampNs = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        record.level = level;
+        record.thread = CurrentThreadNumber();
+        std::vsnprintf(record.message, sizeof(record.message), format, args);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 현재까지 예약된 record가 모두 출력될 때까지 대기
+    void Flush() {
+        std::size_t target = enqueuePos.load(std::memory_order_acquire);
+        while (dequeuePos.load(std::memory_order_acquire) < target) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    }
+
+    void SetOutput(std::FILE* file) { output.store(file ? file : stderr, std::memory_order_release); }
+    std::size_t Dropped() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr std::size_t kMask = Trace::kRingCapacity - 1;
+    static_assert((Trace::kRingCapacity & kMask) == 0, "ring capacity must be a power of two");
+
+    std::unique_ptr<TraceSlot[]> slots;
+    alignas(64) std::atomic<std::size_t> enqueuePos;
+    alignas(64) std::atomic<std::size_t> dequeuePos; // sink thread만 증가
+    std::atomic<std::size_t> dropped;
+    std::atomic<std::FILE*> output;
+    std::chrono::steady_clock::time_point start;
+
+    // consumer: 읽을 수 있는 record를 모두 출력 (출력한 개수 반환)
+    std::size_t Drain() {
+        std::FILE* file = output.load(std::memory_order_acquire);
+        std::size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        std::size_t written = 0;
+        while (true) {
+            TraceSlot& slot = slots[pos & kMask];
+            if (slot.sequence.load(std::memory_order_acquire) != pos + 1) break;
+            const TraceRecord& record = slot.record;
+            std::fprintf(file, "[%12.6f] %-5s #%u %s\n", static_cast<double>(record.timestampNs) * 1e-9,
+                         LevelName(record.level), record.thread, record.message);
+            slot.sequence.store(pos + Trace::kRingCapacity, std::memory_order_release);
+            ++pos;
+            ++written;
+            dequeuePos.store(pos, std::memory_order_release);
+        }
+        if (written > 0) std::fflush(file);
+        return written;
+    }
+
+    void Run() {
+        while (true) {
+            if (Drain() == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+};
+
+// 처음 기록할 때 생성, 종료 시 남은 record 출력 (detach된 thread가 사용할 수 있으므로 해제하지 않음)
+TraceSink& Sink() {
+    static TraceSink* sink = [] {
+        TraceSink* created = new TraceSink();
+        std::atexit([] { Trace::Flush(); });
+        return created;
+    }();
+    return *sink;
+}
+
+} // namespace
+
+void Trace::Write(int level, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    Sink().Push(level, format, args);
+    va_end(args);
+}
+
+void Trace::Flush() {
+    Sink().Flush();
+}
+
+void Trace::SetOutput(std::FILE* file) {
+    Sink().SetOutput(file);
+}
+
+std::size_t Trace::DroppedCount() {
+    return Sink().Dropped();
+}
@@ -0,0 +1,99 @@
+/* Trace.h
+ * Linked file Trace.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * Hot path용 tracing (std::cout 대체)
+ *
+ * - 컴파일 시점 레벨 필터: TRACE_COMPILE_LEVEL보다 상세한 TRACE_* 호출은 코드가 생성되지 않는다
+ *   (인자도 평가하지 않음, printf 형식 검사만 수행).
+ * - 기록: 호출한 thread에서 고정 크기 record에 snprintf로 기록한 뒤 lock-free ring buffer에 넣는다.
+ *   heap 할당, lock, I/O가 없으며 ring이 가득 차면 기록을 버리고 개수만 센다.
+ * - 출력: 별도 sink thread가 ring을 비우며 한 번에 출력한다 (기본 stderr).
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <cstddef>
+#include <cstdio>
+
+// 레벨 (숫자가 클수록 상세)
+#define TRACE_LEVEL_OFF 0
+#define TRACE_LEVEL_ERROR 1
+#define TRACE_LEVEL_WARN 2
+#define TRACE_LEVEL_INFO 3
+#define TRACE_LEVEL_DEBUG 4
+
+// 컴파일할 가장 상세한 레벨 (빌드 옵션으로 변경, 예: -DTRACE_COMPILE_LEVEL=4)
+#ifndef TRACE_COMPILE_LEVEL
+#define TRACE_COMPILE_LEVEL TRACE_LEVEL_INFO
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TRACE_PRINTF_FORMAT(formatIndex, firstArg) __attribute__((format(printf, formatIndex, firstArg)))
+#else
+#define TRACE_PRINTF_FORMAT(formatIndex, firstArg)
+#endif
+
+/**
+ * @brief Trace 클래스.
+ *        직접 호출하기보다 TRACE_ERROR / TRACE_WARN / TRACE_INFO / TRACE_DEBUG 매크로를 사용한다.
+ */
+class Trace {
+public:
+    // 한 record의 최대 메시지 길이 (넘치면 잘림)
+    static constexpr std::size_t kMessageSize = 200;
+    // ring buffer의 record 수 (2의 거듭제곱)
+    static constexpr std::size_t kRingCapacity = 4096;
+
+    /**
+     * @brief record를 ring buffer에 기록합니다 (lock-free, 할당 없음).
+     *
+     * @param level TRACE_LEVEL_* 값.
+     * @param format printf 형식 문자열.
+     */
+    static void Write(int level, const char* format, ...) TRACE_PRINTF_FORMAT(2, 3);
+
+    // 지금까지 기록된 record가 모두 출력될 때까지 대기
+    static void Flush();
+
+    // 출력 대상 변경 (기본 stderr, 호출자가 file을 닫지 않아야 함)
+    static void SetOutput(std::FILE* file);
+
+    // ring이 가득 차서 버려진 record 수
+    static std::size_t DroppedCount();
+
+    // 컴파일에서 제외된 호출의 형식 검사용 (코드 생성 없음)
+    static inline void FormatCheck(const char*, ...) TRACE_PRINTF_FORMAT(1, 2) {}
+};
+
+#define TRACE_DISABLED_(...) do { if (false) Trace::FormatCheck(__VA_ARGS__); } while (0)
+
+#if TRACE_COMPILE_LEVEL >= TRACE_LEVEL_ERROR
+#define TRACE_ERROR(...) Trace::Write(TRACE_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define TRACE_ERROR(...) TRACE_DISABLED_(__VA_ARGS__)
+#endif
+
+#if TRACE_COMPILE_LEVEL >= TRACE_LEVEL_WARN
+#define TRACE_WARN(...) Trace::Write(TRACE_LEVEL_WARN, __VA_ARGS__)
+#else
+#define TRACE_WARN(...) TRACE_DISABLED_(__VA_ARGS__)
+#endif
+
+#if TRACE_COMPILE_LEVEL >= TRACE_LEVEL_INFO
+#define TRACE_INFO(...) Trace::Write(TRACE_LEVEL_INFO, __VA_ARGS__)
+#else
+#define TRACE_INFO(...) TRACE_DISABLED_(__VA_ARGS__)
+#endif
+
+#if TRACE_COMPILE_LEVEL >= TRACE_LEVEL_DEBUG
+#define TRACE_DEBUG(...) Trace::Write(TRACE_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define TRACE_DEBUG(...) TRACE_DISABLED_(__VA_ARGS__)
+#endif
+
+#endif // TRACE_H
@@ -7,162 +7,510 @@
 
 #include "YamlConverter.h"
 #include "AttributesManager.h"
+#include "Profiler.h"
+#include "ThreadPool.h"
+#include "Trace.h"
+#include "YamlEmitter.h"
 #include <yaml-cpp/yaml.h>
+#include <yaml-cpp/eventhandler.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
 #include <iostream>
 #include <fstream>
+#include <streambuf>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
 
-YamlConverter::YamlConverter() {}
+namespace {
 
-YamlConverter::~YamlConverter() {}
+// stream import에서 한 번에 모아 추가하는 항목 수
+constexpr std::size_t kStreamFlushItems = 4096;
+
+// FromYaml이 처리하는 top-level sequence
+enum class YamlSection { None, Nodes, Bearings, Segments };
+
+YamlSection SectionFromKey(const std::string& key) {
+    if (key == "NodeVectors") return YamlSection::Nodes;
+    if (key == "BearingVectors") return YamlSection::Bearings;
+    if (key == "LinerSegments") return YamlSection::Segments;
+    return YamlSection::None;
+}
+
+// segment는 양 끝 index와 설정만 읽고, control point / sample은 import 후 다시 계산
+struct ParsedSegment {
+    int startNode;
+    int endNode;
+    float levelOfDetail;
+    float alpha;
+};
+
+// parse된 항목 (chunk 하나 또는 stream의 일부)
+struct ParsedChunk {
+    std::vector<NodeVector> nodes;
+    std::vector<BearingVector> bearings;
+    std::vector<ParsedSegment> segments;
+
+    std::size_t size() const { return nodes.size() + bearings.size() + segments.size(); }
+};
+
+// 문서 순서대로 manager에 추가하고 비움 (node, bearing, segment 순서: segment가 참조할 node를 먼저 추가)
+void ImportChunk(ParsedChunk& chunk, AttributesManager& attributesManager) {
+    PROFILE_SCOPE("YamlConverter::ImportChunk");
+    for (const NodeVector& node : chunk.nodes) attributesManager.CreateNodeVector(node);
+    for (const BearingVector& bearing : chunk.bearings) attributesManager.CreateBearingVector(bearing);
+    // 여기서는 샘플링하지 않고 commit의 병렬 재샘플링에서 한 번만 샘플링
+    for (const ParsedSegment& segment : chunk.segments) {
+        attributesManager.CreateLinerSegment(segment.startNode, segment.endNode, segment.levelOfDetail,
+                                             segment.alpha);
+    }
+    chunk.nodes.clear();
+    chunk.bearings.clear();
+    chunk.segments.clear();
+}
+
+float ToFloat(const std::string& value) {
+    return std::strtof(value.c_str(), nullptr);
+}
+
+int ToInt(const std::string& value) {
+    return static_cast<int>(std::strtol(value.c_str(), nullptr, 10));
+}
+
+/**
+ * @brief ToString 형식 문서의 parser event를 받아 항목을 ParsedChunk에 모으는 handler.
+ *        fixedSection이 None이면 전체 문서 (root map의 key가 section),
+ *        아니면 해당 section의 sequence 일부만 담은 chunk 문서 (root가 sequence).
+ *        manager가 주어지면 flushSize개마다 바로 추가한다 (stream import).
+ */
+class AttributesEventHandler : public YAML::EventHandler {
+public:
+    AttributesEventHandler(YamlSection fixedSection, ParsedChunk& output,
+                           AttributesManager* manager = nullptr, std::size_t flushSize = 0)
+        : fixed(fixedSection), chunk(output), attributesManager(manager), flushLimit(flushSize),
+          itemDepth(fixedSection == YamlSection::None ? 2 : 1) {}
+
+    void OnDocumentStart(const YAML::Mark&) override { frames.clear(); }
+    void OnDocumentEnd() override {}
+
+    void OnNull(const YAML::Mark&, YAML::anchor_t) override { OnValue(std::string()); }
+    void OnAlias(const YAML::Mark&, YAML::anchor_t) override { OnValue(std::string()); }
+    void OnScalar(const YAML::Mark&, const std::string&, YAML::anchor_t, const std::string& value) override {
+        OnValue(value);
+    }
+
+    void OnSequenceStart(const YAML::Mark&, const std::string&, YAML::anchor_t, YAML::EmitterStyle::value) override {
+        frames.push_back(Frame{false, true, std::string()});
+    }
+    void OnSequenceEnd() override { PopFrame(); }
+
+    void OnMapStart(const YAML::Mark&, const std::string&, YAML::anchor_t, YAML::EmitterStyle::value) override {
+        frames.push_back(Frame{true, true, std::string()});
+        if (frames.size() == itemDepth + 1 && !frames[itemDepth - 1].isMap) BeginItem();
+    }
+    void OnMapEnd() override {
+        if (frames.size() == itemDepth + 1 && inItem) EndItem();
+        PopFrame();
+    }
+
+private:
+    struct Frame {
+        bool isMap;
+        bool expectKey; // map에서 다음 scalar가 key인지 여부
+        std::string key;
+    };
+
+    // 현재 항목의 값
+    struct Item {
+        int index, nodeIndex, depth, startNode, endNode;
+        float r, theta, phi, x, y, z;
+        float bearingPhi, bearingTheta, forceX, forceY, forceZ;
+        float levelOfDetail, alpha;
+        bool hasSpherical, hasCartesian;
+    };
+
+    YamlSection fixed;
+    ParsedChunk& chunk;
+    AttributesManager* attributesManager;
+    std::size_t flushLimit;
+    std::size_t itemDepth; // 항목 map의 frame 깊이
+    std::vector<Frame> frames;
+    YamlSection section = YamlSection::None;
+    bool inItem = false;
+    Item item{};
+
+    void PopFrame() {
+        if (frames.empty()) return;
+        frames.pop_back();
+        // 값이 container였던 map은 다음 scalar를 key로 받음
+        if (!frames.empty() && frames.back().isMap) frames.back().expectKey = true;
+    }
+
+    void OnValue(const std::string& value) {
+        if (frames.empty() || !frames.back().isMap) return; // sequence의 scalar 항목은 사용하지 않음
+        Frame& top = frames.back();
+        if (top.expectKey) {
+            top.key = value;
+            top.expectKey = false;
+            return;
+        }
+        if (inItem) Assign(value);
+        top.expectKey = true;
+    }
+
+    void BeginItem() {
+        section = fixed != YamlSection::None ? fixed : SectionFromKey(frames[0].key);
+        inItem = section != YamlSection::None;
+        item = Item{};
+        item.alpha = 0.5f;
+    }
+
+    // 항목 map부터 현재 map까지의 key 경로로 필드 결정
+    void Assign(const std::string& value) {
+        std::size_t level = frames.size() - 1 - itemDepth;
+        const std::string& key0 = frames[itemDepth].key;
+        const std::string& key = frames.back().key;
+
+        switch (section) {
+        case YamlSection::Nodes:
+            if (level == 0 && key == "index") item.index = ToInt(value);
+            else if (level == 1 && key0 == "spherical") {
+                item.hasSpherical = true;
+                if (key == "r") item.r = ToFloat(value);
+                else if (key == "theta") item.theta = ToFloat(value);
+                else if (key == "phi") item.phi = ToFloat(value);
+            } else if (level == 1 && key0 == "cartesian") {
+                item.hasCartesian = true;
+                if (key == "x") item.x = ToFloat(value);
+                else if (key == "y") item.y = ToFloat(value);
+                else if (key == "z") item.z = ToFloat(value);
+            }
+            break;
+        case YamlSection::Bearings:
+            if (level == 0 && key == "nodeIndex") item.nodeIndex = ToInt(value);
+            else if (level == 0 && key == "depth") item.depth = ToInt(value);
+            else if (level == 1 && key0 == "angles") {
+                if (key == "phi") item.bearingPhi = ToFloat(value);
+                else if (key == "theta") item.bearingTheta = ToFloat(value);
+            } else if (level == 1 && key0 == "force") {
+                if (key == "f_x") item.forceX = ToFloat(value);
+                else if (key == "f_y") item.forceY = ToFloat(value);
+                else if (key == "f_z") item.forceZ = ToFloat(value);
+            }
+            break;
+        case YamlSection::Segments:
+            if (level == 0 && key == "LevelOfDetail") item.levelOfDetail = ToFloat(value);
+            else if (level == 0 && key == "alpha") item.alpha = ToFloat(value);
+            else if (level == 1 && key == "index" && key0 == "NodeStart") item.startNode = ToInt(value);
+            else if (level == 1 && key == "index" && key0 == "NodeEnd") item.endNode = ToInt(value);
+            break;
+        case YamlSection::None:
+            break;
+        }
+    }
+
+    void EndItem() {
+        inItem = false;
+        switch (section) {
+        case YamlSection::Nodes: {
+            // 저장된 형태를 그대로 사용 (두 형태가 모두 있으면 좌표 변환 없음)
+            // 한 형태만 있으면 Lazy로 만들어 NodeStore가 나머지 형태를 batch 변환으로 계산하게 함
+            SphericalNodeVector spherical(item.index, item.r, item.theta, item.phi);
+            CartesianNodeVector cartesian(item.index, item.x, item.y, item.z);
+            if (item.hasSpherical && item.hasCartesian) chunk.nodes.emplace_back(spherical, cartesian);
+            else if (item.hasCartesian) chunk.nodes.emplace_back(cartesian, NodeConversionMode::Lazy);
+            else chunk.nodes.emplace_back(spherical, NodeConversionMode::Lazy);
+            break;
+        }
+        case YamlSection::Bearings:
+            chunk.bearings.emplace_back(item.nodeIndex, item.depth, item.bearingPhi, item.bearingTheta,
+                                        item.forceX, item.forceY, item.forceZ);
+            break;
+        case YamlSection::Segments:
+            chunk.segments.push_back(ParsedSegment{item.startNode, item.endNode, item.levelOfDetail, item.alpha});
+            break;
+        case YamlSection::None:
+            break;
+        }
+        if (attributesManager && chunk.size() >= flushLimit) ImportChunk(chunk, *attributesManager);
+    }
+};
+
+// 복사 없이 메모리 범위를 읽는 streambuf
+class MemoryStreamBuffer : public std::streambuf {
+public:
+    MemoryStreamBuffer(const char* begin, const char* end) {
+        char* first = const_cast<char*>(begin);
+        setg(first, first, const_cast<char*>(end));
+    }
+};
+
+// block style 문서에서 section 하나의 항목 chunk 위치
+struct SectionLayout {
+    YamlSection section;
+    std::vector<std::size_t> chunkStarts; // chunk 시작 offset (chunkBytes 이상 지난 첫 항목마다)
+    std::size_t end = 0;                  // section 끝 offset
+    std::size_t itemCount = 0;
+};
+
+/**
+ * @brief 첫 번째 pass: 줄 단위로 훑어 section별 항목 수와 chunk 경계를 찾는다 (parse 없음).
+ *        top-level key 아래 "- "로 시작하는 block sequence만 이해하며,
+ *        그 외 형태(JSON, flow style 등)면 false를 반환한다.
+ */
+bool ScanBlockLayout(const char* data, std::size_t size, std::size_t chunkBytes,
+                     std::vector<SectionLayout>& layouts) {
+    const std::size_t npos = static_cast<std::size_t>(-1);
+    SectionLayout* current = nullptr;
+    std::size_t itemIndent = npos;
+
+    auto finishSection = [&](std::size_t end) {
+        if (current) current->end = end;
+        current = nullptr;
+    };
+
+    std::size_t lineStart = 0;
+    while (lineStart < size) {
+        const char* newline = static_cast<const char*>(std::memchr(data + lineStart, '\n', size - lineStart));
+        std::size_t lineEnd = newline ? static_cast<std::size_t>(newline - data) : size;
+        std::size_t next = newline ? lineEnd + 1 : size;
+
+        std::size_t indent = 0;
+        while (lineStart + indent < lineEnd && data[lineStart + indent] == ' ') ++indent;
+        std::size_t first = lineStart + indent;
+        char c = first < lineEnd ? data[first] : '\0';
+        bool blank = first >= lineEnd || c == '#' || c == '\r';
+        bool sequenceItem = c == '-' && (first + 1 >= lineEnd || data[first + 1] == ' ' || data[first + 1] == '\r');
+
+        if (blank) {
+            // 빈 줄, 주석
+        } else if (sequenceItem && current && (itemIndent == npos || indent == itemIndent)) {
+            // 항목 시작 (key 아래 column 0의 "- "도 허용)
+            itemIndent = indent;
+            if (current->chunkStarts.empty() || lineStart - current->chunkStarts.back() >= chunkBytes) {
+                current->chunkStarts.push_back(lineStart);
+            }
+            ++current->itemCount;
+        } else if (indent == 0) {
+            if (c == '%' || (lineEnd - first >= 3 && (std::strncmp(data + first, "---", 3) == 0 ||
+                                                      std::strncmp(data + first, "...", 3) == 0))) {
+                if (!layouts.empty()) return false; // 문서 여러 개는 지원하지 않음
+            } else {
+                // top-level key
+                finishSection(lineStart);
+                const char* colon = static_cast<const char*>(std::memchr(data + first, ':', lineEnd - first));
+                if (c == '-' || c == '{' || c == '[' || !colon) return false;
+                std::string key(data + first, colon);
+                std::size_t rest = static_cast<std::size_t>(colon - data) + 1;
+                while (rest < lineEnd && (data[rest] == ' ' || data[rest] == '\r')) ++rest;
+                bool emptySequence = lineEnd - rest >= 2 && data[rest] == '[' && data[rest + 1] == ']';
+                YamlSection section = SectionFromKey(key);
+                if (section != YamlSection::None && rest < lineEnd && !emptySequence) return false;
+                if (section != YamlSection::None && !emptySequence) {
+                    layouts.push_back(SectionLayout{section, {}, 0, 0});
+                    current = &layouts.back();
+                    itemIndent = npos;
+                }
+            }
+        } else if (current && (itemIndent == npos || indent < itemIndent)) {
+            return false; // 항목보다 얕은 줄 (sequence가 아닌 section)
+        }
+        lineStart = next;
+    }
+    finishSection(size);
+    return true;
+}
 
-std::string YamlConverter::ToString(const AttributesManager &attributesManager) {
-    YAML::Emitter out;
-    Attributes attributes = attributesManager.ReadAllAttributes();
-
-    out << YAML::BeginMap;
-
-    // Node Vectors
-    out << YAML::Key << "NodeVectors";
-    out << YAML::BeginSeq;
-    for (const auto& node : attributes.nodeVectors) {
-        auto spherical = node.GetSphericalNodeVector();
-        auto cartesian = node.GetCartesianNodeVector();
-
-        out << YAML::BeginMap;
-        // Include both spherical and cartesian representations
-        out << YAML::Key << "index" << YAML::Value << spherical.i_n;
-        out << YAML::Key << "spherical" << YAML::BeginMap;
-        out << YAML::Key << "r" << YAML::Value << spherical.sphericalCoords.x;       // 수정됨
-        out << YAML::Key << "theta" << YAML::Value << spherical.sphericalCoords.y;   // 수정됨
-        out << YAML::Key << "phi" << YAML::Value << spherical.sphericalCoords.z;     // 수정됨
-        out << YAML::EndMap;
-
-        out << YAML::Key << "cartesian" << YAML::BeginMap;
-        out << YAML::Key << "x" << YAML::Value << cartesian.cartesianCoords.x;         // 수정됨
-        out << YAML::Key << "y" << YAML::Value << cartesian.cartesianCoords.y;         // 수정됨
-        out << YAML::Key << "z" << YAML::Value << cartesian.cartesianCoords.z;         // 수정됨
-        out << YAML::EndMap;
-
-        out << YAML::EndMap;
-    }
-    out << YAML::EndSeq;
-
-    // Bearing Vectors
-    out << YAML::Key << "BearingVectors";
-    out << YAML::BeginSeq;
-    for (const auto& bearing : attributes.bearingVectors) {
-        out << YAML::BeginMap;
-        out << YAML::Key << "nodeIndex" << YAML::Value << bearing.getNodeIndex();
-        out << YAML::Key << "depth" << YAML::Value << bearing.getDepth();
-
-        out << YAML::Key << "angles" << YAML::BeginMap;
-        out << YAML::Key << "phi" << YAML::Value << bearing.getPhi();
-        out << YAML::Key << "theta" << YAML::Value << bearing.getTheta();
-        out << YAML::EndMap;
-
-        auto force = bearing.getForce();
-        out << YAML::Key << "force" << YAML::BeginMap;
-        out << YAML::Key << "f_x" << YAML::Value << force.Force.x;    // 수정됨
-        out << YAML::Key << "f_y" << YAML::Value << force.Force.y;    // 수정됨
-        out << YAML::Key << "f_z" << YAML::Value << force.Force.z;    // 수정됨
-        out << YAML::EndMap;
-
-        out << YAML::EndMap;
-    }
-    out << YAML::EndSeq;
-
-    // Liner Segments
-    out << YAML::Key << "LinerSegments";
-    out << YAML::BeginSeq;
-    for (const auto& segment : attributes.linerSegments) {
-        out << YAML::BeginMap;
-
-        // LinerSegmentData를 사용하여 모든 멤버 변수 출력
-        LinerSegmentData segmentData = segment.ReturnLinerSegmentData();
-
-        // LinerBufferIndex 출력
-        out << YAML::Key << "LinerBufferIndex" << YAML::Value << segmentData.LinerBufferIndex;
-
-        // NodeStart 정보 출력
-        out << YAML::Key << "NodeStart";
-        out << YAML::BeginMap;
-        auto sphericalStart = segmentData.NodeStart.GetSphericalNodeVector();
-        auto cartesianStart = segmentData.NodeStart.GetCartesianNodeVector();
-        out << YAML::Key << "index" << YAML::Value << sphericalStart.i_n;
-        out << YAML::Key << "spherical" << YAML::BeginMap;
-        out << YAML::Key << "r" << YAML::Value << sphericalStart.sphericalCoords.x;       // 수정됨
-        out << YAML::Key << "theta" << YAML::Value << sphericalStart.sphericalCoords.y;   // 수정됨
-        out << YAML::Key << "phi" << YAML::Value << sphericalStart.sphericalCoords.z;     // 수정됨
-        out << YAML::EndMap;
-        out << YAML::Key << "cartesian" << YAML::BeginMap;
-        out << YAML::Key << "x" << YAML::Value << cartesianStart.cartesianCoords.x;       // 수정됨
-        out << YAML::Key << "y" << YAML::Value << cartesianStart.cartesianCoords.y;       // 수정됨
-        out << YAML::Key << "z" << YAML::Value << cartesianStart.cartesianCoords.z;       // 수정됨
-        out << YAML::EndMap;
-        out << YAML::EndMap;
-
-        // NodeEnd 정보 출력
-        out << YAML::Key << "NodeEnd";
-        out << YAML::BeginMap;
-        auto sphericalEnd = segmentData.NodeEnd.GetSphericalNodeVector();
-        auto cartesianEnd = segmentData.NodeEnd.GetCartesianNodeVector();
-        out << YAML::Key << "index" << YAML::Value << sphericalEnd.i_n;
-        out << YAML::Key << "spherical" << YAML::BeginMap;
-        out << YAML::Key << "r" << YAML::Value << sphericalEnd.sphericalCoords.x;         // 수정됨
-        out << YAML::Key << "theta" << YAML::Value << sphericalEnd.sphericalCoords.y;     // 수정됨
-        out << YAML::Key << "phi" << YAML::Value << sphericalEnd.sphericalCoords.z;       // 수정됨
-        out << YAML::EndMap;
-        out << YAML::Key << "cartesian" << YAML::BeginMap;
-        out << YAML::Key << "x" << YAML::Value << cartesianEnd.cartesianCoords.x;           // 수정됨
-        out << YAML::Key << "y" << YAML::Value << cartesianEnd.cartesianCoords.y;           // 수정됨
-        out << YAML::Key << "z" << YAML::Value << cartesianEnd.cartesianCoords.z;           // 수정됨
-        out << YAML::EndMap;
-        out << YAML::EndMap;
-
-        // LevelOfDetail과 alpha 출력
-        out << YAML::Key << "LevelOfDetail" << YAML::Value << segmentData.LevelOfDetail;
-        out << YAML::Key << "alpha" << YAML::Value << segmentData.alpha;
-
-        // Control Points 출력
-        const auto& controlPoints = segment.getControlPoints();
-        out << YAML::Key << "controlPoints" << YAML::BeginSeq;
-        for (const auto& point : controlPoints) {
-            out << YAML::BeginMap;
-            out << YAML::Key << "x" << YAML::Value << point.x;
-            out << YAML::Key << "y" << YAML::Value << point.y;
-            out << YAML::Key << "z" << YAML::Value << point.z;
-            out << YAML::EndMap;
+// [begin, end) 범위의 chunk 문서를 parse
+void ParseChunk(const char* begin, const char* end, YamlSection section, ParsedChunk& output) {
+    MemoryStreamBuffer buffer(begin, end);
+    std::istream stream(&buffer);
+    YAML::Parser parser(stream);
+    AttributesEventHandler handler(section, output);
+    parser.HandleNextDocument(handler);
+}
+
+// 문서 전체를 한 번에 event로 읽으며 kStreamFlushItems개마다 추가
+void StreamDocument(std::istream& in, AttributesManager& attributesManager) {
+    ParsedChunk chunk;
+    YAML::Parser parser(in);
+    AttributesEventHandler handler(YamlSection::None, chunk, &attributesManager, kStreamFlushItems);
+    parser.HandleNextDocument(handler);
+    ImportChunk(chunk, attributesManager);
+}
+
+// 메모리에 있는 문서 import (FromYaml / FromString 공통)
+void ImportBuffer(const char* data, std::size_t size, AttributesManager& attributesManager,
+                  const YamlImportOptions& options) {
+    std::vector<SectionLayout> layouts;
+    if (!ScanBlockLayout(data, size, options.chunkBytes, layouts)) {
+        // block style이 아니면 (JSON 등) 한 번에 stream으로 읽음
+        MemoryStreamBuffer buffer(data, data + size);
+        std::istream stream(&buffer);
+        attributesManager.BeginTransaction();
+        try {
+            StreamDocument(stream, attributesManager);
+        } catch (...) {
+            attributesManager.CommitTransaction();
+            throw;
         }
-        out << YAML::EndSeq;
-
-        // Sampled Points 출력
-        const auto& sampledPoints = segment.getSampledPoints();
-        out << YAML::Key << "sampledPoints" << YAML::BeginSeq;
-        for (const auto& point : sampledPoints) {
-            out << YAML::BeginMap;
-            out << YAML::Key << "x" << YAML::Value << point.x;
-            out << YAML::Key << "y" << YAML::Value << point.y;
-            out << YAML::Key << "z" << YAML::Value << point.z;
-            out << YAML::EndMap;
+        attributesManager.CommitTransaction();
+        return;
+    }
+
+    // chunk 목록 (node, bearing, segment 순서로 추가)
+    struct ChunkRange {
+        YamlSection section;
+        std::size_t begin, end;
+    };
+    std::vector<ChunkRange> ranges;
+    std::size_t counts[4] = {0, 0, 0, 0};
+    for (YamlSection section : {YamlSection::Nodes, YamlSection::Bearings, YamlSection::Segments}) {
+        for (const SectionLayout& layout : layouts) {
+            if (layout.section != section) continue;
+            counts[static_cast<int>(section)] += layout.itemCount;
+            for (std::size_t k = 0; k < layout.chunkStarts.size(); ++k) {
+                std::size_t end = k + 1 < layout.chunkStarts.size() ? layout.chunkStarts[k + 1] : layout.end;
+                ranges.push_back(ChunkRange{section, layout.chunkStarts[k], end});
+            }
         }
-        out << YAML::EndSeq;
+    }
 
-        out << YAML::EndMap;
+    attributesManager.BeginTransaction(counts[static_cast<int>(YamlSection::Nodes)],
+                                       counts[static_cast<int>(YamlSection::Bearings)],
+                                       counts[static_cast<int>(YamlSection::Segments)]);
+    ThreadPool& pool = ThreadPool::Shared();
+    // 한 번에 parse해 두는 chunk 수 (parse된 항목이 차지하는 메모리를 제한)
+    const std::size_t batchSize = options.parallel && pool.size() > 1 ? pool.size() * 2 : 1;
+    std::vector<ParsedChunk> parsed(batchSize);
+    try {
+        for (std::size_t first = 0; first < ranges.size(); first += batchSize) {
+            std::size_t count = std::min(batchSize, ranges.size() - first);
+            auto parse = [&](std::size_t k) {
+                const ChunkRange& range = ranges[first + k];
+                ParseChunk(data + range.begin, data + range.end, range.section, parsed[k]);
+            };
+            if (count == 1) {
+                parse(0);
+            } else {
+                ThreadPool::TaskQueues queues(pool.size());
+                for (std::size_t k = 0; k < count; ++k) queues[k % queues.size()].push_back(k);
+                pool.Run(queues, parse);
+            }
+            for (std::size_t k = 0; k < count; ++k) ImportChunk(parsed[k], attributesManager);
+        }
+    } catch (...) {
+        attributesManager.CommitTransaction(); // 이미 추가한 항목은 반영
+        throw;
     }
-    out << YAML::EndSeq;
+    attributesManager.CommitTransaction();
+}
+
+} // namespace
+
+YamlConverter::YamlConverter() {}
+
+YamlConverter::~YamlConverter() {}
 
-    out << YAML::EndMap;
+std::string YamlConverter::ToString(const AttributesManager &attributesManager, const YamlEmitOptions &options) {
+    // snapshot을 잡고 있는 동안 writer가 수정해도 이 snapshot은 바뀌지 않음
+    std::shared_ptr<const AttributesSnapshot> snapshot = attributesManager.Snapshot();
+    return ToString(*snapshot, options);
+}
+
+std::string YamlConverter::ToString(const AttributesSnapshot &snapshot, const YamlEmitOptions &options) {
+    PROFILE_SCOPE("YamlConverter::ToString");
+    std::string text;
+    StringYamlSink sink(text);
+    Write(snapshot, sink, options);
+    return text;
+}
 
-    return out.c_str();
+bool YamlConverter::Write(const AttributesManager &attributesManager, YamlSink &sink, const YamlEmitOptions &options) {
+    std::shared_ptr<const AttributesSnapshot> snapshot = attributesManager.Snapshot();
+    return Write(*snapshot, sink, options);
+}
+
+bool YamlConverter::Write(const AttributesSnapshot &snapshot, YamlSink &sink, const YamlEmitOptions &options) {
+    PROFILE_SCOPE("YamlConverter::Write");
+    // 문서 구조가 고정이므로 yaml-cpp emitter 대신 YamlEmitter로 직접 format (출력은 같은 byte)
+    return YamlEmitter::Write(snapshot, sink, options);
 }
 
 void YamlConverter::ToYaml(const AttributesManager &attributesManager) {
-    std::string yamlString = ToString(attributesManager);
     std::ofstream fout("attributes.yaml");
     if (fout.is_open()) {
-        fout << yamlString;
+        OstreamYamlSink sink(fout);
+        Write(attributesManager, sink);
         fout.close();
     } else {
         std::cerr << "Error: Unable to open file for writing YAML." << std::endl;
     }
 }
+
+bool YamlConverter::FromYaml(const std::string &path, AttributesManager &attributesManager,
+                             const YamlImportOptions &options) {
+    PROFILE_SCOPE("YamlConverter::FromYaml");
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        TRACE_ERROR("FromYaml: unable to open %s", path.c_str());
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return false;
+    }
+    std::size_t size = static_cast<std::size_t>(info.st_size);
+    if (size == 0) {
+        close(fd);
+        return true; // 빈 문서
+    }
+    // 파일 내용은 page cache에서 바로 읽음 (heap에 복사하지 않음)
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        TRACE_ERROR("FromYaml: mmap failed for %s", path.c_str());
+        return false;
+    }
+    madvise(mapped, size, MADV_SEQUENTIAL);
+
+    bool ok = true;
+    try {
+        ImportBuffer(static_cast<const char*>(mapped), size, attributesManager, options);
+    } catch (const std::exception &e) {
+        TRACE_ERROR("FromYaml: %s: %s", path.c_str(), e.what());
+        ok = false;
+    }
+    munmap(mapped, size);
+    return ok;
+}
+
+bool YamlConverter::FromString(const std::string &text, AttributesManager &attributesManager,
+                               const YamlImportOptions &options) {
+    PROFILE_SCOPE("YamlConverter::FromString");
+    try {
+        ImportBuffer(text.data(), text.size(), attributesManager, options);
+    } catch (const std::exception &e) {
+        TRACE_ERROR("FromString: %s", e.what());
+        return false;
+    }
+    return true;
+}
+
+bool YamlConverter::FromStream(std::istream &in, AttributesManager &attributesManager) {
+    PROFILE_SCOPE("YamlConverter::FromStream");
+    attributesManager.BeginTransaction();
+    bool ok = true;
+    try {
+        StreamDocument(in, attributesManager);
+    } catch (const std::exception &e) {
+        TRACE_ERROR("FromStream: %s", e.what());
+        ok = false;
+    }
+    attributesManager.CommitTransaction();
+    return ok;
+}
@@ -10,24 +10,80 @@
  * Equations
  * Convert AttributesManager to String
  * Convert string to .yaml
+ * Import .yaml (or JSON) into AttributesManager
  */
 
 #ifndef YAML_CONVERTER_H
 #define YAML_CONVERTER_H
 
 #include "AttributesManager.h"
+#include "YamlEmitter.h"
+#include "YamlSink.h"
+#include <cstddef>
+#include <istream>
 #include <string>
 
+// FromYaml 옵션
+struct YamlImportOptions {
+    bool parallel = true;                // sequence를 chunk 단위로 나눠 ThreadPool::Shared()에서 병렬 parse
+    std::size_t chunkBytes = 1 << 20;    // chunk 하나의 대략적인 크기 (항목 경계에서 나눔)
+};
+
 class YamlConverter {
 public:
+    // Write가 sink에 한 번에 넘기는 최대 byte 수 (문서 크기와 관계없이 이만큼만 buffer에 둠)
+    static constexpr std::size_t kStreamChunkSize = YamlEmitter::kStreamChunkSize;
+
     YamlConverter();
     ~YamlConverter();
 
-    // AttributesManager 객체를 문자열로 변환하는 메서드
-    std::string ToString(const AttributesManager &attributesManager);
+    // AttributesManager 객체를 문자열로 변환하는 메서드 (마지막으로 publish된 snapshot 기준)
+    std::string ToString(const AttributesManager &attributesManager,
+                         const YamlEmitOptions &options = YamlEmitOptions());
+
+    // Snapshot을 문자열로 변환하는 메서드 (writer와 동시에 호출 가능)
+    std::string ToString(const AttributesSnapshot &snapshot, const YamlEmitOptions &options = YamlEmitOptions());
+
+    /**
+     * @brief ToString과 같은 문서를 항목 단위로 만들며 sink에 조각으로 넘깁니다.
+     *        문서 전체를 메모리에 두지 않으며, snapshot chunk 단위로 format된 text가 순서대로 sink로 나간다.
+     *
+     * @param snapshot 출력할 snapshot (writer와 동시에 호출 가능).
+     * @param sink 출력 대상 (파일/ostream, socket, byte 수 세기 등).
+     * @param options 출력 필드 (export profile), float 형식, 병렬 format 여부 (기본값은 yaml-cpp 출력과 같은 byte).
+     * @return 성공 여부 (sink가 실패하면 false).
+     */
+    bool Write(const AttributesSnapshot &snapshot, YamlSink &sink, const YamlEmitOptions &options = YamlEmitOptions());
+
+    // 마지막으로 publish된 snapshot 출력
+    bool Write(const AttributesManager &attributesManager, YamlSink &sink,
+               const YamlEmitOptions &options = YamlEmitOptions());
 
     // AttributesManager 객체를 YAML 파일로 변환하는 메서드
     void ToYaml(const AttributesManager &attributesManager);
+
+    /**
+     * @brief ToString 형식의 YAML(또는 같은 구조의 JSON) 파일을 AttributesManager에 추가합니다.
+     *        YAML::Node DOM을 만들지 않고 parser event를 바로 처리하며, 하나의 transaction으로 반영한다.
+     *        파일은 mmap으로 열고 먼저 항목 수를 세어 capacity를 예약한 뒤 chunk 단위로 읽는다.
+     *        node는 저장된 spherical/cartesian 값을 그대로 사용하고, segment의 control point와
+     *        sample은 저장된 값 대신 commit 시 다시 계산한다.
+     *        실패하면 그 전까지 읽은 항목은 추가된 상태로 남는다.
+     *
+     * @param path 읽을 파일 경로.
+     * @param attributesManager 항목을 추가할 manager.
+     * @param options 병렬 parse 여부, chunk 크기.
+     * @return 성공 여부.
+     */
+    bool FromYaml(const std::string &path, AttributesManager &attributesManager,
+                  const YamlImportOptions &options = YamlImportOptions());
+
+    // 메모리에 있는 문서를 추가 (FromYaml과 같은 방식)
+    bool FromString(const std::string &text, AttributesManager &attributesManager,
+                    const YamlImportOptions &options = YamlImportOptions());
+
+    // stream에서 한 번만 읽으며 추가 (항목 수를 미리 알 수 없어 capacity 예약과 병렬 parse 없음)
+    bool FromStream(std::istream &in, AttributesManager &attributesManager);
 };
 
 #endif // YAML_CONVERTER_H
\ No newline at end of file
@@ -0,0 +1,307 @@
+/* YamlEmitter.cpp
+ * Linked file YamlEmitter.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * YamlEmitter 구현: 고정 key template + std::to_chars + chunk 단위 병렬 format
+ */
+
+#include "YamlEmitter.h"
+#include "Profiler.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+// 미리 만들어 둔 key/들여쓰기 문자열 붙이기 (길이는 compile time에 결정)
+template <std::size_t N>
+inline void AppendText(std::string& out, const char (&text)[N]) {
+    out.append(text, N - 1);
+}
+
+inline void AppendInt(std::string& out, int value) {
+    char buffer[16];
+    std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, static_cast<std::size_t>(result.ptr - buffer));
+}
+
+// 값 하나 = key template + 숫자
+template <std::size_t N>
+inline void AppendField(std::string& out, const char (&key)[N], float value, YamlFloatFormat format) {
+    AppendText(out, key);
+    YamlEmitter::AppendFloat(out, value, format);
+}
+
+template <std::size_t N>
+inline void AppendField(std::string& out, const char (&key)[N], int value) {
+    AppendText(out, key);
+    AppendInt(out, value);
+}
+
+// LinerSegment의 NodeStart / NodeEnd 본문 (key 다음 줄부터)
+void AppendSegmentNode(std::string& out, const NodeVector& node, const YamlEmitOptions& options) {
+    SphericalNodeVector spherical = node.GetSphericalNodeVector();
+    AppendField(out, "\n      index: ", spherical.i_n);
+    if (!(options.fields & YamlField::SegmentEndpointCoordinates)) return;
+
+    const YamlFloatFormat format = options.floatFormat;
+    CartesianNodeVector cartesian = node.GetCartesianNodeVector();
+    AppendField(out, "\n      spherical:\n        r: ", spherical.sphericalCoords.x, format);
+    AppendField(out, "\n        theta: ", spherical.sphericalCoords.y, format);
+    AppendField(out, "\n        phi: ", spherical.sphericalCoords.z, format);
+    AppendField(out, "\n      cartesian:\n        x: ", cartesian.cartesianCoords.x, format);
+    AppendField(out, "\n        y: ", cartesian.cartesianCoords.y, format);
+    AppendField(out, "\n        z: ", cartesian.cartesianCoords.z, format);
+}
+
+// segment 안의 점 sequence (비어 있으면 yaml-cpp와 같이 "[]")
+void AppendPoints(std::string& out, const std::vector<Vector3>& points, YamlFloatFormat format) {
+    if (points.empty()) {
+        AppendText(out, "\n      []");
+        return;
+    }
+    for (const Vector3& point : points) {
+        AppendField(out, "\n      - x: ", point.x, format);
+        AppendField(out, "\n        y: ", point.y, format);
+        AppendField(out, "\n        z: ", point.z, format);
+    }
+}
+
+// 항목마다 "\n"으로 시작하며, 이어 붙이면 문서의 해당 section 본문이 된다
+void FormatNodes(const NodeStore& chunk, std::string& out, const YamlEmitOptions& options) {
+    const YamlFloatFormat format = options.floatFormat;
+    const bool withSpherical = (options.fields & YamlField::NodeSpherical) != 0;
+    const bool withCartesian = (options.fields & YamlField::NodeCartesian) != 0;
+    NodeSphericalView spherical = chunk.spherical();
+    NodeCartesianView cartesian = chunk.cartesian();
+    out.reserve(spherical.size * (20 + (withSpherical ? 70 : 0) + (withCartesian ? 70 : 0)));
+    for (std::size_t i = 0; i < spherical.size; ++i) {
+        AppendField(out, "\n  - index: ", spherical.index[i]);
+        if (withSpherical) {
+            AppendField(out, "\n    spherical:\n      r: ", spherical.r[i], format);
+            AppendField(out, "\n      theta: ", spherical.theta[i], format);
+            AppendField(out, "\n      phi: ", spherical.phi[i], format);
+        }
+        if (withCartesian) {
+            AppendField(out, "\n    cartesian:\n      x: ", cartesian.x[i], format);
+            AppendField(out, "\n      y: ", cartesian.y[i], format);
+            AppendField(out, "\n      z: ", cartesian.z[i], format);
+        }
+    }
+}
+
+void FormatBearings(const std::vector<BearingVector>& chunk, std::string& out, const YamlEmitOptions& options) {
+    const YamlFloatFormat format = options.floatFormat;
+    out.reserve(chunk.size() * 160);
+    for (const BearingVector& bearing : chunk) {
+        BearingVectorForce force = bearing.getForce();
+        AppendField(out, "\n  - nodeIndex: ", bearing.getNodeIndex());
+        AppendField(out, "\n    depth: ", bearing.getDepth());
+        AppendField(out, "\n    angles:\n      phi: ", bearing.getPhi(), format);
+        AppendField(out, "\n      theta: ", bearing.getTheta(), format);
+        AppendField(out, "\n    force:\n      f_x: ", force.Force.x, format);
+        AppendField(out, "\n      f_y: ", force.Force.y, format);
+        AppendField(out, "\n      f_z: ", force.Force.z, format);
+    }
+}
+
+void FormatSegments(const std::vector<SegmentRecord>& chunk, std::string& out, const YamlEmitOptions& options) {
+    const YamlFloatFormat format = options.floatFormat;
+    const std::uint32_t fields = options.fields;
+    const bool withControl = (fields & YamlField::SegmentControlPoints) != 0;
+    const bool withSamples = (fields & YamlField::SegmentSampledPoints) != 0;
+    std::size_t points = 0;
+    for (const SegmentRecord& segment : chunk) {
+        if (withControl) points += segment.controlPoints.size();
+        if (withSamples) points += segment.sampledPoints.size();
+    }
+    out.reserve(chunk.size() * 640 + points * 64);
+    for (const SegmentRecord& segment : chunk) {
+        const LinerSegmentData& segmentData = segment.data;
+        AppendField(out, "\n  - LinerBufferIndex: ", segmentData.LinerBufferIndex);
+        if (fields & YamlField::SegmentEndpoints) {
+            AppendText(out, "\n    NodeStart:");
+            AppendSegmentNode(out, segmentData.NodeStart, options);
+            AppendText(out, "\n    NodeEnd:");
+            AppendSegmentNode(out, segmentData.NodeEnd, options);
+        }
+        if (fields & YamlField::SegmentParameters) {
+            AppendField(out, "\n    LevelOfDetail: ", segmentData.LevelOfDetail, format);
+            AppendField(out, "\n    alpha: ", segmentData.alpha, format);
+        }
+        if (withControl) {
+            AppendText(out, "\n    controlPoints:");
+            AppendPoints(out, segment.controlPoints, format);
+        }
+        if (withSamples) {
+            AppendText(out, "\n    sampledPoints:");
+            AppendPoints(out, segment.sampledPoints, format);
+        }
+    }
+}
+
+template <std::size_t N>
+inline bool WriteText(YamlSink& sink, const char (&text)[N]) {
+    return sink.Write(text, N - 1);
+}
+
+// format된 text를 kStreamChunkSize 이하 조각으로 sink에 넘김
+bool WriteText(YamlSink& sink, const std::string& text) {
+    for (std::size_t offset = 0; offset < text.size(); offset += YamlEmitter::kStreamChunkSize) {
+        std::size_t size = std::min(YamlEmitter::kStreamChunkSize, text.size() - offset);
+        if (!sink.Write(text.data() + offset, size)) return false;
+    }
+    return true;
+}
+
+// top-level section key (첫 section이 아니면 앞 항목 뒤에 줄바꿈)
+// 빈 sequence는 yaml-cpp와 같이 key 다음 줄에 "[]"
+template <std::size_t N>
+bool WriteSectionKey(YamlSink& sink, bool& first, const char (&key)[N], std::size_t itemCount) {
+    if (!first && !WriteText(sink, "\n")) return false;
+    first = false;
+    if (!WriteText(sink, key)) return false;
+    return itemCount > 0 || WriteText(sink, "\n  []");
+}
+
+// section 하나를 chunk 단위로 format (batch 안에서는 병렬, sink에는 문서 순서대로)
+template <typename Chunk, typename Formatter>
+bool WriteSection(const SnapshotChunks<Chunk>& chunks, YamlSink& sink, const YamlEmitOptions& options,
+                  Formatter format) {
+    ThreadPool& pool = ThreadPool::Shared();
+    const std::size_t batchSize =
+        options.parallel && pool.size() > 1 ? pool.size() * YamlEmitter::kChunksPerWorker : 1;
+    std::vector<std::string> texts(std::min(batchSize, chunks.size()));
+    for (std::size_t first = 0; first < chunks.size(); first += batchSize) {
+        std::size_t count = std::min(batchSize, chunks.size() - first);
+        auto formatChunk = [&](std::size_t k) {
+            texts[k].clear();
+            format(*chunks[first + k], texts[k], options);
+        };
+        if (count == 1) {
+            formatChunk(0);
+        } else {
+            ThreadPool::TaskQueues queues(pool.size());
+            for (std::size_t k = 0; k < count; ++k) queues[k % queues.size()].push_back(k);
+            pool.Run(queues, formatChunk);
+        }
+        for (std::size_t k = 0; k < count; ++k) {
+            if (!WriteText(sink, texts[k])) return false;
+        }
+    }
+    return true;
+}
+
+// ParseFields가 알아보는 이름
+struct FieldName {
+    const char* name;
+    std::uint32_t fields;
+};
+
+constexpr FieldName kFieldNames[] = {
+    {"full", YamlField::All},
+    {"topology-only", YamlField::TopologyOnly},
+    {"render-points", YamlField::RenderPoints},
+    {"nodes", YamlField::Nodes},
+    {"nodes.spherical", YamlField::Nodes | YamlField::NodeSpherical},
+    {"nodes.cartesian", YamlField::Nodes | YamlField::NodeCartesian},
+    {"bearings", YamlField::Bearings},
+    {"segments", YamlField::Segments},
+    {"segments.endpoints", YamlField::Segments | YamlField::SegmentEndpoints},
+    {"segments.endpointCoordinates",
+     YamlField::Segments | YamlField::SegmentEndpoints | YamlField::SegmentEndpointCoordinates},
+    {"segments.parameters", YamlField::Segments | YamlField::SegmentParameters},
+    {"segments.controlPoints", YamlField::Segments | YamlField::SegmentControlPoints},
+    {"segments.sampledPoints", YamlField::Segments | YamlField::SegmentSampledPoints},
+};
+
+} // namespace
+
+bool YamlEmitter::ParseFields(const std::string& spec, std::uint32_t& fields) {
+    std::uint32_t result = 0;
+    std::size_t begin = 0;
+    while (begin <= spec.size()) {
+        std::size_t end = spec.find(',', begin);
+        if (end == std::string::npos) end = spec.size();
+        std::string name = spec.substr(begin, end - begin);
+        // 앞뒤 공백 제거
+        std::size_t first = name.find_first_not_of(" \t");
+        if (first == std::string::npos) return false;
+        name = name.substr(first, name.find_last_not_of(" \t") - first + 1);
+
+        bool found = false;
+        for (const FieldName& entry : kFieldNames) {
+            if (name == entry.name) {
+                result |= entry.fields;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            // 숫자 mask (10진수 또는 0x...)
+            char* parsedEnd = nullptr;
+            unsigned long mask = std::strtoul(name.c_str(), &parsedEnd, 0);
+            if (!std::isdigit(static_cast<unsigned char>(name[0])) || *parsedEnd != '\0' ||
+                (mask & ~static_cast<unsigned long>(YamlField::All)) != 0) {
+                return false;
+            }
+            result |= static_cast<std::uint32_t>(mask);
+        }
+        begin = end + 1;
+    }
+    fields = result;
+    return true;
+}
+
+void YamlEmitter::AppendFloat(std::string& out, float value, YamlFloatFormat format) {
+    // yaml-cpp와 같은 특수 값 표기
+    if (std::isnan(value)) {
+        AppendText(out, ".nan");
+        return;
+    }
+    if (std::isinf(value)) {
+        if (value > 0) {
+            AppendText(out, ".inf");
+        } else {
+            AppendText(out, "-.inf");
+        }
+        return;
+    }
+
+    char buffer[32];
+    std::to_chars_result result;
+    if (format == YamlFloatFormat::Shortest) {
+        result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    } else {
+        // yaml-cpp의 기본 float precision (std::numeric_limits<float>::max_digits10)과 같은 출력
+        result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, 9);
+    }
+    out.append(buffer, static_cast<std::size_t>(result.ptr - buffer));
+}
+
+bool YamlEmitter::Write(const AttributesSnapshot& snapshot, YamlSink& sink, const YamlEmitOptions& options) {
+    PROFILE_SCOPE("YamlEmitter::Write");
+
+    bool first = true;
+    if (options.fields & YamlField::Nodes) {
+        if (!WriteSectionKey(sink, first, "NodeVectors:", snapshot.nodeCount)) return false;
+        if (!WriteSection(snapshot.nodeChunks, sink, options, FormatNodes)) return false;
+    }
+    if (options.fields & YamlField::Bearings) {
+        if (!WriteSectionKey(sink, first, "BearingVectors:", snapshot.bearingCount)) return false;
+        if (!WriteSection(snapshot.bearingChunks, sink, options, FormatBearings)) return false;
+    }
+    if (options.fields & YamlField::Segments) {
+        if (!WriteSectionKey(sink, first, "LinerSegments:", snapshot.segmentCount)) return false;
+        if (!WriteSection(snapshot.segmentChunks, sink, options, FormatSegments)) return false;
+    }
+    // section이 하나도 없으면 빈 map
+    return !first || WriteText(sink, "{}");
+}
@@ -0,0 +1,110 @@
+/* YamlEmitter.h
+ * Linked file YamlEmitter.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * AttributesSnapshot 전용 YAML text emitter (YamlConverter::ToString / Write의 구현)
+ *
+ * 문서 구조가 고정되어 있으므로 yaml-cpp의 범용 emitter 대신
+ * - key와 들여쓰기는 미리 만들어 둔 문자열을 그대로 복사하고
+ * - 숫자는 std::to_chars로 buffer에 직접 쓰며
+ * - snapshot chunk마다 별도 문자열에 병렬로 만든 뒤 문서 순서대로 sink에 넘긴다.
+ * 기본 출력은 yaml-cpp YAML::Emitter 출력과 byte 단위로 같다 (float은 유효 숫자 9자리).
+ *
+ * Export profile
+ * YamlEmitOptions::fields (YamlField bit mask)로 다시 계산할 수 있거나 다른 필드와 중복되는 필드를 뺀다.
+ * - full          : 모든 필드 (기본값)
+ * - topology-only : node index/spherical/cartesian, bearing, segment 양 끝 index와 LevelOfDetail/alpha
+ *                   (FromYaml로 읽으면 control point, sample은 다시 계산되어 full 문서와 같은 scene이 됨.
+ *                    sampler가 읽는 cartesian은 다시 계산하면 오차가 생기므로 빼지 않음)
+ * - render-points : segment의 LinerBufferIndex와 sampledPoints만 (render client용)
+ */
+
+#ifndef YAMLEMITTER_H
+#define YAMLEMITTER_H
+
+#include "AttributesSnapshot.h"
+#include "YamlSink.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// float 출력 형식
+enum class YamlFloatFormat {
+    Compatible, // 유효 숫자 9자리 (yaml-cpp와 같은 byte, 기본값)
+    Shortest    // 같은 float으로 다시 읽히는 가장 짧은 표현 (값은 같고 문서가 더 작음)
+};
+
+// 출력 필드 (YamlEmitOptions::fields bit mask)
+// section bit가 없으면 그 section의 key 자체를 출력하지 않고, 나머지 bit는 해당 section 항목 안의 필드를 고른다.
+namespace YamlField {
+enum : std::uint32_t {
+    Nodes = 1u << 0,                      // NodeVectors section (항목마다 index)
+    NodeSpherical = 1u << 1,              // node의 spherical
+    NodeCartesian = 1u << 2,              // node의 cartesian (spherical에서 다시 계산 가능)
+    Bearings = 1u << 3,                   // BearingVectors section
+    Segments = 1u << 4,                   // LinerSegments section (항목마다 LinerBufferIndex)
+    SegmentEndpoints = 1u << 5,           // NodeStart / NodeEnd의 index
+    SegmentEndpointCoordinates = 1u << 6, // NodeStart / NodeEnd의 spherical, cartesian (NodeVectors와 중복, SegmentEndpoints 필요)
+    SegmentParameters = 1u << 7,          // LevelOfDetail, alpha
+    SegmentControlPoints = 1u << 8,       // controlPoints (양 끝 node와 bearing에서 다시 계산 가능)
+    SegmentSampledPoints = 1u << 9,       // sampledPoints
+
+    All = (1u << 10) - 1,
+    TopologyOnly = Nodes | NodeSpherical | NodeCartesian | Bearings | Segments | SegmentEndpoints | SegmentParameters,
+    RenderPoints = Segments | SegmentSampledPoints
+};
+} // namespace YamlField
+
+// YamlConverter::ToString / Write 옵션
+struct YamlEmitOptions {
+    std::uint32_t fields = YamlField::All; // YamlField bit mask
+    YamlFloatFormat floatFormat = YamlFloatFormat::Compatible;
+    // snapshot chunk를 ThreadPool::Shared()에서 병렬로 format
+    // ThreadPool::Run은 호출을 하나씩 처리하므로 render thread가 아닌 곳 (SocketServer 등)에서는 false로 두어
+    // FlushDirtySegments가 export를 기다리지 않게 한다
+    bool parallel = true;
+};
+
+/**
+ * @brief YamlEmitter 클래스.
+ */
+class YamlEmitter {
+public:
+    // sink에 한 번에 넘기는 최대 byte 수
+    static constexpr std::size_t kStreamChunkSize = 64 * 1024;
+
+    // 한 번에 format해 두는 snapshot chunk 수의 worker당 배수 (format된 text가 차지하는 메모리를 제한)
+    static constexpr std::size_t kChunksPerWorker = 2;
+
+    /**
+     * @brief snapshot을 YAML 문서로 만들어 sink에 조각 단위로 넘깁니다.
+     *
+     * @param snapshot 출력할 snapshot.
+     * @param sink 출력 대상.
+     * @param options 출력 필드, float 형식, 병렬 여부.
+     * @return 성공 여부 (sink가 실패하면 false).
+     */
+    static bool Write(const AttributesSnapshot& snapshot, YamlSink& sink,
+                      const YamlEmitOptions& options = YamlEmitOptions());
+
+    /**
+     * @brief profile 이름 또는 field 이름 목록을 YamlField mask로 바꿉니다.
+     *        preset (full, topology-only, render-points), field 이름 (nodes, nodes.spherical, nodes.cartesian,
+     *        bearings, segments, segments.endpoints, segments.endpointCoordinates, segments.parameters,
+     *        segments.controlPoints, segments.sampledPoints), 숫자 mask (10진수 또는 0x)를
+     *        ','로 이어 쓰면 합집합이 된다. 예: "topology-only,segments.sampledPoints"
+     *
+     * @param spec profile 문자열.
+     * @param fields 결과 mask (실패하면 바꾸지 않음).
+     * @return 모든 이름을 알아본 경우 true.
+     */
+    static bool ParseFields(const std::string& spec, std::uint32_t& fields);
+
+    // float 하나를 out 뒤에 붙임 (.nan, .inf, -.inf 포함)
+    static void AppendFloat(std::string& out, float value, YamlFloatFormat format);
+};
+
+#endif // YAMLEMITTER_H
@@ -0,0 +1,79 @@
+/* YamlSink.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * YamlConverter::Write가 문서를 조각 단위로 넘기는 출력 대상
+ *
+ * YamlConverter는 문서 전체를 메모리에 만들지 않고 고정 크기 buffer가 찰 때마다 sink에 넘긴다.
+ * socket 출력 sink는 SocketServer에 있다.
+ */
+
+#ifndef YAMLSINK_H
+#define YAMLSINK_H
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+/**
+ * @brief 출력 대상 interface.
+ */
+class YamlSink {
+public:
+    virtual ~YamlSink() = default;
+
+    /**
+     * @brief 문서의 다음 조각을 기록합니다.
+     *
+     * @param data 조각의 시작 (호출이 끝나면 재사용되므로 보관하지 않아야 함).
+     * @param size 조각의 byte 수.
+     * @return 성공 여부 (false면 이후 조각은 넘기지 않음).
+     */
+    virtual bool Write(const char* data, std::size_t size) = 0;
+};
+
+// std::ostream (std::ofstream 등)에 기록
+class OstreamYamlSink : public YamlSink {
+public:
+    explicit OstreamYamlSink(std::ostream& output) : stream(output) {}
+
+    bool Write(const char* data, std::size_t size) override {
+        stream.write(data, static_cast<std::streamsize>(size));
+        return static_cast<bool>(stream);
+    }
+
+private:
+    std::ostream& stream;
+};
+
+// std::string 뒤에 이어 붙임 (ToString)
+class StringYamlSink : public YamlSink {
+public:
+    explicit StringYamlSink(std::string& output) : text(output) {}
+
+    bool Write(const char* data, std::size_t size) override {
+        text.append(data, size);
+        return true;
+    }
+
+private:
+    std::string& text;
+};
+
+// byte 수만 셈 (문서 크기 추정, Content-Length 등)
+class CountingYamlSink : public YamlSink {
+public:
+    bool Write(const char*, std::size_t size) override {
+        count += size;
+        return true;
+    }
+
+    std::size_t bytes() const { return count; }
+
+private:
+    std::size_t count = 0;
+};
+
+#endif // YAMLSINK_H
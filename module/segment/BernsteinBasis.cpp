@@ -0,0 +1,100 @@
+/* BernsteinBasis.cpp
+ * Implementation of the BernsteinBasis and BernsteinBasisCache classes
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ */
+
+#include "BernsteinBasis.h"
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+// Constructor: Equ(15) 점화식으로 각 t_s의 basis 계산
+BernsteinBasis::BernsteinBasis(int degree, int sampleCount)
+    : degree(degree), sampleCount(sampleCount), weights(rows() * cols()) {
+    std::vector<double> b(cols());
+    for (std::size_t s = 0; s < rows(); ++s) {
+        double t = static_cast<double>(s) / sampleCount;
+        double u = 1.0 - t;
+
+        // b_{0,0} = 1 에서 시작해 차수를 하나씩 올림
+        b[0] = 1.0;
+        for (int k = 1; k <= degree; ++k) {
+            b[k] = t * b[k - 1];
+            for (int i = k - 1; i > 0; --i) {
+                b[i] = u * b[i] + t * b[i - 1];
+            }
+            b[0] = u * b[0];
+        }
+
+        float* out = weights.data() + s * cols();
+        for (std::size_t i = 0; i < cols(); ++i) {
+            out[i] = static_cast<float>(b[i]);
+        }
+    }
+}
+
+// sampled = basis × controlPoints
+void BernsteinBasis::Evaluate(const Vector3* controlPoints, Vector3* sampled) const {
+    const std::size_t n = cols();
+    for (std::size_t s = 0; s < rows(); ++s) {
+        const float* w = row(s);
+        float x = 0.0f, y = 0.0f, z = 0.0f;
+        for (std::size_t j = 0; j < n; ++j) {
+            x += w[j] * controlPoints[j].x;
+            y += w[j] * controlPoints[j].y;
+            z += w[j] * controlPoints[j].z;
+        }
+        sampled[s] = Vector3(x, y, z);
+    }
+}
+
+namespace {
+
+struct BasisCacheState {
+    std::shared_mutex mutex;
+    std::unordered_map<std::uint64_t, std::shared_ptr<const BernsteinBasis>> entries;
+};
+
+BasisCacheState& CacheState() {
+    static BasisCacheState state;
+    return state;
+}
+
+std::uint64_t MakeKey(int degree, int sampleCount) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(degree)) << 32) |
+           static_cast<std::uint32_t>(sampleCount);
+}
+
+} // namespace
+
+// 행렬 조회 (읽기는 shared lock, 생성은 lock 밖에서 수행)
+std::shared_ptr<const BernsteinBasis> BernsteinBasisCache::Get(int degree, int sampleCount) {
+    BasisCacheState& state = CacheState();
+    const std::uint64_t key = MakeKey(degree, sampleCount);
+    {
+        std::shared_lock<std::shared_mutex> lock(state.mutex);
+        auto it = state.entries.find(key);
+        if (it != state.entries.end()) return it->second;
+    }
+
+    auto basis = std::make_shared<const BernsteinBasis>(degree, sampleCount);
+    std::unique_lock<std::shared_mutex> lock(state.mutex);
+    // 다른 스레드가 먼저 등록했다면 그 행렬을 사용
+    auto inserted = state.entries.emplace(key, std::move(basis));
+    return inserted.first->second;
+}
+
+std::size_t BernsteinBasisCache::Size() {
+    BasisCacheState& state = CacheState();
+    std::shared_lock<std::shared_mutex> lock(state.mutex);
+    return state.entries.size();
+}
+
+void BernsteinBasisCache::Clear() {
+    BasisCacheState& state = CacheState();
+    std::unique_lock<std::shared_mutex> lock(state.mutex);
+    state.entries.clear();
+}
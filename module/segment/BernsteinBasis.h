@@ -0,0 +1,70 @@
+/* BernsteinBasis.h
+ * Linked file BernsteinBasis.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose:
+ * 1. Precompute Bernstein basis matrices for uniform sampling of Bezier curves
+ * 2. Share the matrices across segments and threads (process-wide cache)
+ *
+ * Equations (번호는 LinerSegment.h에 이어서 붙임)
+ * Equ(8): \vec{B}\left(t\right)=\sum_{i=0}^{n}\binom{n}{i}\left(1-t\right)^{n-i}t^i\vec{P_i},\emsp0\le t\le1
+ * Equ(15): b_{i,n}\left(t\right)=\left(1-t\right)b_{i,n-1}\left(t\right)+t\,b_{i-1,n-1}\left(t\right)
+ */
+#ifndef BERNSTEINBASIS_H
+#define BERNSTEINBASIS_H
+
+#include "Vector3.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Bernstein basis 행렬 (불변 객체).
+ *        행 s는 t_s = s / sampleCount 에서의 b_{0..n,n}(t_s) 값.
+ *        Equ(15) 점화식을 double로 계산하므로 binomial 계수의 overflow가 없다.
+ */
+class BernsteinBasis {
+public:
+    BernsteinBasis(int degree, int sampleCount);
+
+    int getDegree() const { return degree; }
+    int getSampleCount() const { return sampleCount; }
+    std::size_t rows() const { return static_cast<std::size_t>(sampleCount) + 1; }
+    std::size_t cols() const { return static_cast<std::size_t>(degree) + 1; }
+
+    // 행 s의 basis 값 (cols()개)
+    const float* row(std::size_t s) const { return weights.data() + s * cols(); }
+
+    /**
+     * @brief sampled = basis × controlPoints.
+     *
+     * @param controlPoints cols()개의 control point.
+     * @param sampled rows()개의 결과를 기록할 배열.
+     */
+    void Evaluate(const Vector3* controlPoints, Vector3* sampled) const;
+
+private:
+    int degree;
+    int sampleCount;
+    std::vector<float> weights; // rows() × cols(), row-major
+};
+
+/**
+ * @brief (degree, sampleCount)를 key로 하는 프로세스 전역 BernsteinBasis cache.
+ *        반환된 행렬은 불변이며 여러 스레드에서 동시에 사용해도 안전하다.
+ */
+class BernsteinBasisCache {
+public:
+    // 해당 key의 행렬을 반환 (없으면 생성 후 등록)
+    static std::shared_ptr<const BernsteinBasis> Get(int degree, int sampleCount);
+
+    // 등록된 행렬 수
+    static std::size_t Size();
+
+    // 모든 행렬 해제 (이미 반환된 행렬은 shared_ptr가 유지)
+    static void Clear();
+};
+
+#endif // BERNSTEINBASIS_H
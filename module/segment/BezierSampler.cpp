@@ -0,0 +1,413 @@
+/* BezierSampler.cpp
+ * Implementation of the BezierSampler class
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ */
+
+#include "BezierSampler.h"
+
+// de Casteljau로 한 점 계산 (Equ(16))
+Vector3 BezierSampler::EvaluateDeCasteljau(const Vector3* controlPoints, int degree, float t, Vector3* scratch) {
+    for (int i = 0; i <= degree; ++i) {
+        scratch[i] = controlPoints[i];
+    }
+    const float u = 1.0f - t;
+    for (int k = 1; k <= degree; ++k) {
+        for (int i = 0; i <= degree - k; ++i) {
+            scratch[i] = u * scratch[i] + t * scratch[i + 1];
+        }
+    }
+    return scratch[0];
+}
+
+// de Casteljau 균일 샘플링
+void BezierSampler::SampleDeCasteljau(const Vector3* controlPoints, int degree, int sampleCount,
+                                      Vector3* sampled, std::vector<Vector3>& scratch) {
+    if (scratch.size() < static_cast<std::size_t>(degree) + 1) {
+        scratch.resize(static_cast<std::size_t>(degree) + 1);
+    }
+    for (int s = 0; s <= sampleCount; ++s) {
+        float t = static_cast<float>(s) / sampleCount;
+        sampled[s] = EvaluateDeCasteljau(controlPoints, degree, t, scratch.data());
+    }
+}
+
+// 전진 차분 균일 샘플링 (Equ(17))
+void BezierSampler::SampleForwardDifference(const Vector3* controlPoints, int degree, int sampleCount,
+                                            Vector3* sampled, std::vector<double>& scratch) {
+    const std::size_t n1 = static_cast<std::size_t>(degree) + 1;
+    if (scratch.size() < 6 * n1) {
+        scratch.resize(6 * n1);
+    }
+    double* dx = scratch.data();
+    double* dy = dx + n1;
+    double* dz = dy + n1;
+    double* wx = dz + n1; // de Casteljau 작업 공간
+    double* wy = wx + n1;
+    double* wz = wy + n1;
+
+    // 차분 테이블 초기값: t_k = k * h (k = 0..n) 에서 double de Casteljau로 계산
+    const double h = 1.0 / sampleCount;
+    for (std::size_t k = 0; k < n1; ++k) {
+        const double t = static_cast<double>(k) * h;
+        const double u = 1.0 - t;
+        for (std::size_t i = 0; i < n1; ++i) {
+            wx[i] = controlPoints[i].x;
+            wy[i] = controlPoints[i].y;
+            wz[i] = controlPoints[i].z;
+        }
+        for (std::size_t level = 1; level < n1; ++level) {
+            for (std::size_t i = 0; i < n1 - level; ++i) {
+                wx[i] = u * wx[i] + t * wx[i + 1];
+                wy[i] = u * wy[i] + t * wy[i + 1];
+                wz[i] = u * wz[i] + t * wz[i + 1];
+            }
+        }
+        dx[k] = wx[0];
+        dy[k] = wy[0];
+        dz[k] = wz[0];
+    }
+
+    // 값 테이블을 차분 테이블로 변환: d[k] = Δ^k B(0)
+    for (std::size_t k = 1; k < n1; ++k) {
+        for (std::size_t i = n1 - 1; i >= k; --i) {
+            dx[i] -= dx[i - 1];
+            dy[i] -= dy[i - 1];
+            dz[i] -= dz[i - 1];
+        }
+    }
+
+    // 한 단계마다 d[k] += d[k + 1] (덧셈만 사용)
+    for (int s = 0; s <= sampleCount; ++s) {
+        sampled[s] = Vector3(static_cast<float>(dx[0]), static_cast<float>(dy[0]), static_cast<float>(dz[0]));
+        for (std::size_t k = 0; k + 1 < n1; ++k) {
+            dx[k] += dx[k + 1];
+            dy[k] += dy[k + 1];
+            dz[k] += dz[k + 1];
+        }
+    }
+}
+
+// B(t), B'(t), B''(t) 계산
+void BezierSampler::EvaluateWithDerivatives(const Vector3* controlPoints, int degree, float t, Vector3* scratch,
+                                            Vector3& point, Vector3& firstDerivative, Vector3& secondDerivative) {
+    for (int i = 0; i <= degree; ++i) {
+        scratch[i] = controlPoints[i];
+    }
+    const float u = 1.0f - t;
+    const float n = static_cast<float>(degree);
+    firstDerivative = Vector3(0.0f, 0.0f, 0.0f);
+    secondDerivative = Vector3(0.0f, 0.0f, 0.0f);
+    for (int k = 1; k <= degree; ++k) {
+        // 남은 점이 3개 (degree - k + 2 == 3) 일 때: 2차 hodograph 값
+        if (degree - k + 2 == 3) {
+            secondDerivative = n * (n - 1.0f) * (scratch[2] - 2.0f * scratch[1] + scratch[0]);
+        }
+        // 남은 점이 2개일 때: 1차 hodograph 값
+        if (degree - k + 2 == 2) {
+            firstDerivative = n * (scratch[1] - scratch[0]);
+        }
+        for (int i = 0; i <= degree - k; ++i) {
+            scratch[i] = u * scratch[i] + t * scratch[i + 1];
+        }
+    }
+    point = scratch[0];
+}
+
+// Equ(14): κ = |B'' × B'| / |B'|^3
+float BezierSampler::Curvature(const Vector3& firstDerivative, const Vector3& secondDerivative) {
+    float speed = firstDerivative.magnitude();
+    if (speed < 1e-12f) return 0.0f;
+    return secondDerivative.cross(firstDerivative).magnitude() / (speed * speed * speed);
+}
+
+// 오차 기반 적응형 샘플링
+void BezierSampler::SampleAdaptive(const Vector3* controlPoints, int degree, float tolerance,
+                                   ScenePointVector& sampled, BezierAdaptiveScratch& scratch, int maxDepth) {
+    sampled.clear();
+    if (degree < 0) return;
+    if (degree == 0) {
+        sampled.push_back(controlPoints[0]);
+        return;
+    }
+    if (scratch.casteljau.size() < static_cast<std::size_t>(degree) + 1) {
+        scratch.casteljau.resize(static_cast<std::size_t>(degree) + 1);
+    }
+    Vector3* work = scratch.casteljau.data();
+    auto& stack = scratch.stack;
+    stack.clear();
+
+    // 중점 하나로 놓칠 수 있는 변곡(S자)을 잡기 위해 degree개의 균일 구간에서 시작
+    const int initialSegments = degree < 2 ? 2 : degree;
+    Vector3 previous = controlPoints[0];
+    sampled.push_back(previous);
+    // 오른쪽 구간부터 push하여 왼쪽 구간이 먼저 처리되도록 함
+    for (int s = initialSegments; s >= 1; --s) {
+        float t0 = static_cast<float>(s - 1) / initialSegments;
+        float t1 = static_cast<float>(s) / initialSegments;
+        Vector3 p0 = (s == 1) ? controlPoints[0] : EvaluateDeCasteljau(controlPoints, degree, t0, work);
+        Vector3 p1 = (s == initialSegments) ? controlPoints[degree] : EvaluateDeCasteljau(controlPoints, degree, t1, work);
+        stack.push_back({t0, t1, p0, p1, 0});
+    }
+
+    while (!stack.empty()) {
+        BezierAdaptiveScratch::Interval iv = stack.back();
+        stack.pop_back();
+
+        float tm = 0.5f * (iv.t0 + iv.t1);
+        Vector3 pm, d1, d2;
+        EvaluateWithDerivatives(controlPoints, degree, tm, work, pm, d1, d2);
+
+        // chord 오차와 곡률 기반 오차 추정 (Equ(19))
+        Vector3 chord = iv.p1 - iv.p0;
+        float chordLength = chord.magnitude();
+        float chordError = (pm - 0.5f * (iv.p0 + iv.p1)).magnitude();
+        float curvatureError = Curvature(d1, d2) * chordLength * chordLength * 0.125f;
+        float error = chordError > curvatureError ? chordError : curvatureError;
+
+        if (error > tolerance && iv.depth < maxDepth) {
+            stack.push_back({tm, iv.t1, pm, iv.p1, iv.depth + 1});
+            stack.push_back({iv.t0, tm, iv.p0, pm, iv.depth + 1});
+        } else {
+            sampled.push_back(iv.p1);
+        }
+    }
+}
+
+namespace {
+// 3차 Bezier 한 조각 계산
+Vector3 EvaluateCubic(const Vector3* q, float u) {
+    const float v = 1.0f - u;
+    return (v * v * v) * q[0] + (3.0f * v * v * u) * q[1] + (3.0f * v * u * u) * q[2] + (u * u * u) * q[3];
+}
+}
+
+// 3차 Hermite 조각 chain 변환 (Equ(20))
+void BezierSampler::BuildCubicChain(const Vector3* controlPoints, int degree, float tolerance,
+                                    BezierCubicChain& chain, BezierCubicScratch& scratch, int maxDepth) {
+    chain.breaks.clear();
+    chain.points.clear();
+    if (degree < 0) return;
+    if (scratch.casteljau.size() < static_cast<std::size_t>(degree) + 1) {
+        scratch.casteljau.resize(static_cast<std::size_t>(degree) + 1);
+    }
+    Vector3* work = scratch.casteljau.data();
+    auto& stack = scratch.stack;
+    stack.clear();
+
+    // 조각 하나가 대략 3차만큼의 형상을 담당하도록 ceil(degree / 3)개의 균일 구간에서 시작
+    const int initialSegments = degree > 3 ? (degree + 2) / 3 : 1;
+    Vector3 unused;
+    for (int s = initialSegments; s >= 1; --s) {
+        BezierCubicScratch::Interval iv;
+        iv.t0 = static_cast<float>(s - 1) / initialSegments;
+        iv.t1 = static_cast<float>(s) / initialSegments;
+        EvaluateWithDerivatives(controlPoints, degree, iv.t0, work, iv.p0, iv.d0, unused);
+        EvaluateWithDerivatives(controlPoints, degree, iv.t1, work, iv.p1, iv.d1, unused);
+        iv.depth = 0;
+        stack.push_back(iv);
+    }
+
+    chain.breaks.push_back(0.0f);
+    chain.points.push_back(stack.back().p0);
+    while (!stack.empty()) {
+        BezierCubicScratch::Interval iv = stack.back();
+        stack.pop_back();
+
+        const float h = iv.t1 - iv.t0;
+        Vector3 q[4] = {iv.p0, iv.p0 + (h / 3.0f) * iv.d0, iv.p1 - (h / 3.0f) * iv.d1, iv.p1};
+
+        // 내부 세 점에서 원래 곡선과 비교
+        float error = 0.0f;
+        Vector3 pm, dm;
+        for (int k = 1; k <= 3; ++k) {
+            float u = 0.25f * k;
+            Vector3 exact;
+            if (k == 2) {
+                EvaluateWithDerivatives(controlPoints, degree, iv.t0 + u * h, work, pm, dm, unused);
+                exact = pm;
+            } else {
+                exact = EvaluateDeCasteljau(controlPoints, degree, iv.t0 + u * h, work);
+            }
+            float e = (exact - EvaluateCubic(q, u)).magnitude();
+            if (e > error) error = e;
+        }
+
+        if (error > tolerance && iv.depth < maxDepth) {
+            const float tm = iv.t0 + 0.5f * h;
+            stack.push_back({tm, iv.t1, pm, dm, iv.p1, iv.d1, iv.depth + 1});
+            stack.push_back({iv.t0, tm, iv.p0, iv.d0, pm, dm, iv.depth + 1});
+        } else {
+            chain.points.push_back(q[1]);
+            chain.points.push_back(q[2]);
+            chain.points.push_back(q[3]);
+            chain.breaks.push_back(iv.t1);
+        }
+    }
+}
+
+// 3차 조각 chain 균일 샘플링
+void BezierSampler::SampleCubicChain(const BezierCubicChain& chain, int sampleCount, Vector3* sampled) {
+    const std::size_t pieces = chain.pieceCount();
+    if (pieces == 0) return;
+    std::size_t k = 0;
+    for (int s = 0; s <= sampleCount; ++s) {
+        const float t = static_cast<float>(s) / sampleCount;
+        // t는 단조 증가하므로 조각 위치는 앞으로만 이동
+        while (k + 1 < pieces && t > chain.breaks[k + 1]) ++k;
+        const float t0 = chain.breaks[k];
+        const float t1 = chain.breaks[k + 1];
+        float u = (t - t0) / (t1 - t0);
+        if (u < 0.0f) u = 0.0f;
+        if (u > 1.0f) u = 1.0f;
+        sampled[s] = EvaluateCubic(chain.points.data() + 3 * k, u);
+    }
+}
+
+// t 배열에 대한 B, B', B'', κ 일괄 계산
+void BezierSampler::EvaluateFrames(const Vector3* controlPoints, int degree, const float* t, std::size_t count,
+                                   BezierFrameBatch& out) {
+    constexpr std::size_t L = kFrameLanes;
+    out.position.resize(count);
+    out.firstDerivative.resize(count);
+    out.secondDerivative.resize(count);
+    out.curvature.resize(count);
+    if (count == 0 || degree < 0) return;
+
+    const std::size_t n = static_cast<std::size_t>(degree);
+    const std::size_t n1 = n + 1;
+
+    // 작업 버퍼 배치 (float 단위)
+    //   hodograph:   H1 (n개), H2 (n-1개)의 x, y, z              -> 3 * (2n)
+    //   binomial:    C(n, i), C(n-1, i), C(n-2, i)                -> 3 * n1
+    //   power lanes: t^i, (1-t)^i (i = 0..n) × L                  -> 2 * n1 * L
+    //   accum lanes: B, B', B''의 x, y, z × L                     -> 9 * L
+    const std::size_t hodographSize = 3 * 2 * (n + 1);
+    const std::size_t binomialSize = 3 * n1;
+    const std::size_t powerSize = 2 * n1 * L;
+    const std::size_t accumSize = 9 * L;
+    const std::size_t required = hodographSize + binomialSize + powerSize + accumSize;
+    if (out.scratch.size() < required) {
+        out.scratch.resize(required);
+    }
+    float* h1x = out.scratch.data();
+    float* h1y = h1x + (n + 1);
+    float* h1z = h1y + (n + 1);
+    float* h2x = h1z + (n + 1);
+    float* h2y = h2x + (n + 1);
+    float* h2z = h2y + (n + 1);
+    float* binomN = h2z + (n + 1);
+    float* binomN1 = binomN + n1;
+    float* binomN2 = binomN1 + n1;
+    float* tPow = binomN2 + n1;
+    float* uPow = tPow + n1 * L;
+    float* acc = uPow + n1 * L;
+
+    // Equ(18): 1차 hodograph H1_i = n (P_{i+1} - P_i), 2차 H2_i = (n - 1)(H1_{i+1} - H1_i)
+    for (std::size_t i = 0; i + 1 < n1; ++i) {
+        Vector3 d = static_cast<float>(n) * (controlPoints[i + 1] - controlPoints[i]);
+        h1x[i] = d.x;
+        h1y[i] = d.y;
+        h1z[i] = d.z;
+    }
+    for (std::size_t i = 0; i + 2 < n1; ++i) {
+        h2x[i] = static_cast<float>(n - 1) * (h1x[i + 1] - h1x[i]);
+        h2y[i] = static_cast<float>(n - 1) * (h1y[i + 1] - h1y[i]);
+        h2z[i] = static_cast<float>(n - 1) * (h1z[i + 1] - h1z[i]);
+    }
+
+    // 이항 계수 (double로 계산 후 float로 저장)
+    auto fillBinomial = [](float* row, std::size_t m) {
+        double c = 1.0;
+        for (std::size_t i = 0; i <= m; ++i) {
+            row[i] = static_cast<float>(c);
+            c = c * static_cast<double>(m - i) / static_cast<double>(i + 1);
+        }
+    };
+    fillBinomial(binomN, n);
+    if (n >= 1) fillBinomial(binomN1, n - 1);
+    if (n >= 2) fillBinomial(binomN2, n - 2);
+
+    float laneT[L];
+    for (std::size_t base = 0; base < count; base += L) {
+        const std::size_t active = (count - base < L) ? count - base : L;
+        for (std::size_t lane = 0; lane < L; ++lane) {
+            laneT[lane] = t[base + (lane < active ? lane : active - 1)];
+        }
+
+        // t^i, (1-t)^i 를 lane 배열로 계산
+        for (std::size_t lane = 0; lane < L; ++lane) {
+            tPow[lane] = 1.0f;
+            uPow[lane] = 1.0f;
+        }
+        for (std::size_t i = 1; i < n1; ++i) {
+            float* tp = tPow + i * L;
+            float* up = uPow + i * L;
+            const float* tpPrev = tp - L;
+            const float* upPrev = up - L;
+            for (std::size_t lane = 0; lane < L; ++lane) {
+                tp[lane] = tpPrev[lane] * laneT[lane];
+                up[lane] = upPrev[lane] * (1.0f - laneT[lane]);
+            }
+        }
+
+        for (std::size_t k = 0; k < accumSize; ++k) acc[k] = 0.0f;
+        float* bx = acc;
+        float* by = bx + L;
+        float* bz = by + L;
+        float* d1x = bz + L;
+        float* d1y = d1x + L;
+        float* d1z = d1y + L;
+        float* d2x = d1z + L;
+        float* d2y = d2x + L;
+        float* d2z = d2y + L;
+
+        // B(t) = Σ C(n, i) t^i (1-t)^(n-i) P_i
+        for (std::size_t i = 0; i < n1; ++i) {
+            const float* tp = tPow + i * L;
+            const float* up = uPow + (n - i) * L;
+            const float c = binomN[i];
+            const float px = controlPoints[i].x, py = controlPoints[i].y, pz = controlPoints[i].z;
+            for (std::size_t lane = 0; lane < L; ++lane) {
+                float w = c * tp[lane] * up[lane];
+                bx[lane] += w * px;
+                by[lane] += w * py;
+                bz[lane] += w * pz;
+            }
+        }
+        // B'(t) = Σ C(n-1, i) t^i (1-t)^(n-1-i) H1_i
+        for (std::size_t i = 0; n >= 1 && i < n; ++i) {
+            const float* tp = tPow + i * L;
+            const float* up = uPow + (n - 1 - i) * L;
+            const float c = binomN1[i];
+            for (std::size_t lane = 0; lane < L; ++lane) {
+                float w = c * tp[lane] * up[lane];
+                d1x[lane] += w * h1x[i];
+                d1y[lane] += w * h1y[i];
+                d1z[lane] += w * h1z[i];
+            }
+        }
+        // B''(t) = Σ C(n-2, i) t^i (1-t)^(n-2-i) H2_i
+        for (std::size_t i = 0; n >= 2 && i + 1 < n; ++i) {
+            const float* tp = tPow + i * L;
+            const float* up = uPow + (n - 2 - i) * L;
+            const float c = binomN2[i];
+            for (std::size_t lane = 0; lane < L; ++lane) {
+                float w = c * tp[lane] * up[lane];
+                d2x[lane] += w * h2x[i];
+                d2y[lane] += w * h2y[i];
+                d2z[lane] += w * h2z[i];
+            }
+        }
+
+        for (std::size_t lane = 0; lane < active; ++lane) {
+            Vector3 d1(d1x[lane], d1y[lane], d1z[lane]);
+            Vector3 d2(d2x[lane], d2y[lane], d2z[lane]);
+            out.position[base + lane] = Vector3(bx[lane], by[lane], bz[lane]);
+            out.firstDerivative[base + lane] = d1;
+            out.secondDerivative[base + lane] = d2;
+            out.curvature[base + lane] = Curvature(d1, d2);
+        }
+    }
+}
@@ -0,0 +1,222 @@
+/* BezierSampler.h
+ * Linked file BezierSampler.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose:
+ * Uniform-t sampling engines for the Bezier curve of LinerSegment
+ * 1. BernsteinTable: Equ(8) direct sum using the shared BernsteinBasis matrix, O(n) per sample
+ * 2. ForwardDifference: forward differencing of the polynomial, O(n) additions per sample, no pow/multiply
+ * 3. DeCasteljau: repeated linear interpolation, O(n^2) per sample, numerically stable for high degree
+ * 4. Adaptive: subdivide t only where the chord error or the curvature estimate exceeds a tolerance
+ * 5. PiecewiseCubic: replace a high-degree curve by a tolerance-bounded C1 chain of cubic Hermite pieces,
+ *    built once per control point change; each sample then costs O(1) regardless of degree
+ *
+ * Equations (번호는 LinerSegment.h에 이어서 붙임)
+ * Equ(8): \vec{B}\left(t\right)=\sum_{i=0}^{n}\binom{n}{i}\left(1-t\right)^{n-i}t^i\vec{P_i},\emsp0\le t\le1
+ * Equ(14): \kappa\left(t\right)=\frac{|\vec{B^{\prime\prime}}\left(t\right)\times\vec{B^\prime}\left(t\right)|}{|\vec{B^\prime}\left(t\right)|^3}
+ * Equ(16): \vec{P_i^{(k)}}=\left(1-t\right)\vec{P_i^{(k-1)}}+t\vec{P_{i+1}^{(k-1)}}
+ * Equ(17): \Delta^k\vec{B}\left(t_s\right)=\Delta^{k-1}\vec{B}\left(t_{s+1}\right)-\Delta^{k-1}\vec{B}\left(t_s\right)
+ * Equ(18): \vec{B^\prime}\left(t\right)=n\sum_{i=0}^{n-1}b_{i,n-1}\left(t\right)\left(\vec{P_{i+1}}-\vec{P_i}\right)
+ * Equ(19): e\approx\frac{\kappa L^2}{8}
+ * Equ(20): \vec{Q_0}=\vec{B}\left(t_0\right),\ \vec{Q_1}=\vec{Q_0}+\frac{h}{3}\vec{B^\prime}\left(t_0\right),\ \vec{Q_2}=\vec{Q_3}-\frac{h}{3}\vec{B^\prime}\left(t_1\right),\ \vec{Q_3}=\vec{B}\left(t_1\right),\ h=t_1-t_0
+ */
+#ifndef BEZIERSAMPLER_H
+#define BEZIERSAMPLER_H
+
+#include "Vector3.h"
+#include "SceneArena.h"
+#include <vector>
+
+/**
+ * @brief Bezier curve 균일 샘플링 방식.
+ */
+enum class BezierEvaluator {
+    BernsteinTable,    ///< 공유 basis 행렬 × control points (기본값)
+    ForwardDifference, ///< 전진 차분, 낮은 차수(≤ 6)에서 가장 빠름. 차수가 높으면 오차가 급격히 커짐
+    DeCasteljau,       ///< de Casteljau, 느리지만 높은 차수에서도 안정적
+    PiecewiseCubic     ///< 허용 오차 이내의 3차 조각 chain으로 변환 후 샘플링, 샘플당 O(1)
+};
+
+/**
+ * @brief LinerSegment의 샘플 개수 결정 방식.
+ */
+enum class SamplingMode {
+    Uniform, ///< LevelOfDetail 개의 균일 구간 (BezierEvaluator 사용)
+    Adaptive ///< 허용 오차(error budget)를 넘는 구간만 분할
+};
+
+/**
+ * @brief 적응형 샘플링 작업 버퍼 (호출 간 재사용).
+ */
+struct BezierAdaptiveScratch {
+    struct Interval {
+        float t0, t1;
+        Vector3 p0, p1;
+        int depth;
+    };
+    std::vector<Vector3> casteljau;
+    std::vector<Interval> stack;
+};
+
+/**
+ * @brief 원래 곡선을 근사하는 3차 Bezier 조각들의 chain (C1 연속).
+ *        조각 k는 t ∈ [breaks[k], breaks[k+1]] 를 담당하며,
+ *        control point는 points[3k] ~ points[3k+3] (이웃 조각과 끝점을 공유).
+ */
+struct BezierCubicChain {
+    std::vector<float> breaks;   ///< 조각 경계 t (pieceCount() + 1개)
+    std::vector<Vector3> points; ///< 3 * pieceCount() + 1개의 control point
+
+    std::size_t pieceCount() const { return breaks.empty() ? 0 : breaks.size() - 1; }
+};
+
+/**
+ * @brief 3차 조각 변환 작업 버퍼 (호출 간 재사용).
+ */
+struct BezierCubicScratch {
+    struct Interval {
+        float t0, t1;
+        Vector3 p0, d0; // B(t0), B'(t0)
+        Vector3 p1, d1; // B(t1), B'(t1)
+        int depth;
+    };
+    std::vector<Vector3> casteljau;
+    std::vector<Interval> stack;
+};
+
+/**
+ * @brief 임의의 t 배열에 대한 B(t), B'(t), B''(t), κ(t) 결과 (호출 간 재사용).
+ *        출력 벡터와 작업 버퍼의 용량은 유지되므로 같은 크기로 다시 호출하면 할당이 없다.
+ */
+struct BezierFrameBatch {
+    std::vector<Vector3> position;         ///< B(t)
+    std::vector<Vector3> firstDerivative;  ///< B'(t) (접선 방향)
+    std::vector<Vector3> secondDerivative; ///< B''(t)
+    std::vector<float> curvature;          ///< κ(t), Equ(14)
+    std::vector<float> scratch;            ///< 내부 작업 버퍼
+};
+
+/**
+ * @brief BezierSampler 클래스.
+ *        control point 배열로부터 t_s = s / sampleCount (0 ≤ s ≤ sampleCount) 위치를 계산.
+ *        scratch 인자는 호출 간에 재사용 가능한 작업 버퍼 (용량이 충분하면 할당 없음).
+ */
+class BezierSampler {
+public:
+    /**
+     * @brief 전진 차분으로 sampleCount + 1개의 점을 계산합니다 (Equ(17)).
+     *        차분 레지스터는 double로 누적한다.
+     *
+     * @param controlPoints degree + 1개의 control point.
+     * @param degree Bezier 차수 n.
+     * @param sampleCount 구간 수 (결과는 sampleCount + 1개).
+     * @param sampled 결과 배열.
+     * @param scratch 작업 버퍼 (6 * (degree + 1)개의 double).
+     */
+    static void SampleForwardDifference(const Vector3* controlPoints, int degree, int sampleCount,
+                                        Vector3* sampled, std::vector<double>& scratch);
+
+    /**
+     * @brief de Casteljau 알고리즘으로 sampleCount + 1개의 점을 계산합니다 (Equ(16)).
+     *
+     * @param controlPoints degree + 1개의 control point.
+     * @param degree Bezier 차수 n.
+     * @param sampleCount 구간 수 (결과는 sampleCount + 1개).
+     * @param sampled 결과 배열.
+     * @param scratch 작업 버퍼 (degree + 1개의 Vector3).
+     */
+    static void SampleDeCasteljau(const Vector3* controlPoints, int degree, int sampleCount,
+                                  Vector3* sampled, std::vector<Vector3>& scratch);
+
+    /**
+     * @brief de Casteljau 알고리즘으로 한 점 B(t)를 계산합니다.
+     *
+     * @param controlPoints degree + 1개의 control point.
+     * @param degree Bezier 차수 n.
+     * @param t 매개변수.
+     * @param scratch degree + 1개 이상의 Vector3 작업 공간.
+     * @return Vector3 B(t).
+     */
+    static Vector3 EvaluateDeCasteljau(const Vector3* controlPoints, int degree, float t, Vector3* scratch);
+
+    /**
+     * @brief B(t), B'(t), B''(t)를 한 번의 de Casteljau로 계산합니다.
+     *        마지막 두 단계의 차분이 hodograph(Equ(18))와 그 hodograph를 t에서 계산한 값과 같다.
+     *
+     * @param controlPoints degree + 1개의 control point.
+     * @param degree Bezier 차수 n.
+     * @param t 매개변수.
+     * @param scratch degree + 1개 이상의 Vector3 작업 공간.
+     * @param point B(t).
+     * @param firstDerivative B'(t).
+     * @param secondDerivative B''(t) (degree < 2 이면 0).
+     */
+    static void EvaluateWithDerivatives(const Vector3* controlPoints, int degree, float t, Vector3* scratch,
+                                        Vector3& point, Vector3& firstDerivative, Vector3& secondDerivative);
+
+    /**
+     * @brief Equ(14) 곡률. |B'| 가 0에 가까우면 0을 반환합니다.
+     */
+    static float Curvature(const Vector3& firstDerivative, const Vector3& secondDerivative);
+
+    /**
+     * @brief 허용 오차 이하가 될 때까지 구간을 분할하며 샘플링합니다.
+     *        구간 [t0, t1]의 중점에서 chord 오차 |B(t_m) - (B(t0) + B(t1)) / 2| 와
+     *        곡률 추정 오차 κ(t_m) L^2 / 8 (Equ(19), L = chord 길이) 중 큰 값이 tolerance를 넘으면 분할한다.
+     *
+     * @param controlPoints degree + 1개의 control point.
+     * @param degree Bezier 차수 n.
+     * @param tolerance 구간당 허용 오차 (세그먼트의 error budget).
+     * @param sampled 결과 (t = 0 부터 t = 1 까지 순서대로, 기존 내용은 지워짐).
+     * @param scratch 작업 버퍼.
+     * @param maxDepth 최대 분할 깊이 (초기 구간 기준).
+     */
+    static void SampleAdaptive(const Vector3* controlPoints, int degree, float tolerance,
+                               ScenePointVector& sampled, BezierAdaptiveScratch& scratch, int maxDepth = 12);
+
+    /**
+     * @brief 곡선을 허용 오차 이내의 3차 Hermite 조각 chain으로 변환합니다 (Equ(20)).
+     *        각 조각은 구간 양 끝의 위치와 도함수를 보존하므로 chain은 C1 연속이며,
+     *        구간 내부 세 점(1/4, 1/2, 3/4)의 오차가 tolerance를 넘으면 구간을 반으로 나눈다.
+     *        degree ≤ 3 이면 한 조각으로 정확히 표현된다.
+     *
+     * @param controlPoints degree + 1개의 control point.
+     * @param degree Bezier 차수 n.
+     * @param tolerance 조각당 허용 오차.
+     * @param chain 결과 chain.
+     * @param scratch 작업 버퍼.
+     * @param maxDepth 최대 분할 깊이.
+     */
+    static void BuildCubicChain(const Vector3* controlPoints, int degree, float tolerance,
+                                BezierCubicChain& chain, BezierCubicScratch& scratch, int maxDepth = 10);
+
+    /**
+     * @brief 3차 조각 chain에서 t_s = s / sampleCount 위치를 계산합니다 (샘플당 O(1)).
+     *
+     * @param chain BuildCubicChain의 결과.
+     * @param sampleCount 구간 수 (결과는 sampleCount + 1개).
+     * @param sampled 결과 배열.
+     */
+    static void SampleCubicChain(const BezierCubicChain& chain, int sampleCount, Vector3* sampled);
+
+    // EvaluateFrames가 한 번에 처리하는 t 개수 (lane 단위 루프로 컴파일러가 벡터화)
+    static constexpr int kFrameLanes = 16;
+
+    /**
+     * @brief t 배열 전체에 대해 B, B', B'', κ를 한 번에 계산합니다.
+     *        1차/2차 hodograph control point를 한 번 만든 뒤, kFrameLanes 개의 t마다
+     *        t^i, (1-t)^i 를 lane 배열로 만들어 Bernstein 합을 계산한다 (t당 O(n)).
+     *
+     * @param controlPoints degree + 1개의 control point.
+     * @param degree Bezier 차수 n.
+     * @param t 매개변수 배열 (count개, 임의 순서).
+     * @param count t 개수.
+     * @param out 결과 (각 배열이 count 크기로 조정됨).
+     */
+    static void EvaluateFrames(const Vector3* controlPoints, int degree, const float* t, std::size_t count,
+                               BezierFrameBatch& out);
+};
+
+#endif // BEZIERSAMPLER_H
@@ -22,88 +22,134 @@
  */
 
 #include "LinerSegment.h"
+#include "Profiler.h"
+#include "Trace.h"
+#include <utility>
 
-// 성분별 곱셈 함수 추가
-Vector3 hadamardProduct(const Vector3& a, const Vector3& b) {
-    return Vector3(a.x * b.x, a.y * b.y, a.z * b.z);
+// Constructor (node/bearing 복사본 사용)
+LinerSegment::LinerSegment(const NodeVectorWithBearing& n1, const NodeVectorWithBearing& n2, float lod, float alphaVal)
+    : LevelOfDetail(lod), startNodeIndex(n1.node.GetSphericalNodeVector().i_n),
+      endNodeIndex(n2.node.GetSphericalNodeVector().i_n), topology(nullptr), node_1(n1), node_2(n2),
+      alpha(alphaVal), L_min(0.1f), L_max(10.0f),
+      evaluator(BezierEvaluator::BernsteinTable), samplingMode(SamplingMode::Uniform), errorTolerance(0.01f), dirty(false) {
+    SamplingBezierCurve();
 }
 
-// Constructor
-LinerSegment::LinerSegment(const NodeVectorWithBearing& n1, const NodeVectorWithBearing& n2, float lod, float alphaVal)
-    : node_1(n1), node_2(n2), LevelOfDetail(lod), alpha(alphaVal), L_min(0.1f), L_max(10.0f) {
+// Constructor (공유 topology 참조)
+LinerSegment::LinerSegment(int startNode, int endNode, const SegmentTopologySource& source, float lod, float alphaVal)
+    : LevelOfDetail(lod), startNodeIndex(startNode), endNodeIndex(endNode), topology(&source),
+      alpha(alphaVal), L_min(0.1f), L_max(10.0f),
+      evaluator(BezierEvaluator::BernsteinTable), samplingMode(SamplingMode::Uniform), errorTolerance(0.01f), dirty(false) {
     SamplingBezierCurve();
 }
 
+// Constructor (공유 topology 참조, 저장된 점 사용)
+LinerSegment::LinerSegment(int startNode, int endNode, const SegmentTopologySource& source, float lod, float alphaVal,
+                           ScenePointVector storedControlPoints, ScenePointVector storedSampledPoints)
+    : LevelOfDetail(lod), startNodeIndex(startNode), endNodeIndex(endNode), topology(&source),
+      controlPoints(std::move(storedControlPoints)), sampledPoints(std::move(storedSampledPoints)),
+      alpha(alphaVal), L_min(0.1f), L_max(10.0f),
+      evaluator(BezierEvaluator::BernsteinTable), samplingMode(SamplingMode::Uniform), errorTolerance(0.01f), dirty(false) {
+}
+
+// 공유 topology에 연결 (복사본 해제)
+void LinerSegment::BindTopology(const SegmentTopologySource* source) {
+    topology = source;
+    if (topology) {
+        node_1 = NodeVectorWithBearing();
+        node_2 = NodeVectorWithBearing();
+    }
+}
+
+// 복사본과 source 비교 (좌표와 방향은 같은 값에서 계산되므로 정확히 비교)
+bool LinerSegment::MatchesTopology(const SegmentTopologySource& source) const {
+    if (topology) return false;
+    ScenePointVector directions;
+    for (const NodeVectorWithBearing* end : {&node_1, &node_2}) {
+        int nodeIndex = end == &node_1 ? startNodeIndex : endNodeIndex;
+        Vector3 position;
+        if (!source.NodePosition(nodeIndex, position)) return false;
+        Vector3 copied = end->node.GetCartesianNodeVector().cartesianCoords;
+        if (position.x != copied.x || position.y != copied.y || position.z != copied.z) return false;
+
+        directions.clear();
+        source.BearingDirections(nodeIndex, directions);
+        if (directions.size() != end->bearings.size()) return false;
+        for (std::size_t i = 0; i < directions.size(); ++i) {
+            const Vector3& direction = end->bearings[i].getWeightedDirection();
+            if (directions[i].x != direction.x || directions[i].y != direction.y || directions[i].z != direction.z) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// 점 배열을 다른 allocator로 이동 (move 대입이 allocator를 함께 옮김)
+void LinerSegment::setAllocator(const ArenaAllocator<Vector3>& allocator) {
+    if (controlPoints.get_allocator() == allocator) return;
+    startDirections = ScenePointVector(startDirections.begin(), startDirections.end(), allocator);
+    endDirections = ScenePointVector(endDirections.begin(), endDirections.end(), allocator);
+    controlPoints = ScenePointVector(controlPoints.begin(), controlPoints.end(), allocator);
+    sampledPoints = ScenePointVector(sampledPoints.begin(), sampledPoints.end(), allocator);
+}
+
+// 양 끝 node 좌표와 bearing의 B ⊗ F 수집 (node가 없으면 false)
+bool LinerSegment::gatherEndpoints(Vector3& N1, Vector3& N2) {
+    startDirections.clear();
+    endDirections.clear();
+    if (topology) {
+        if (!topology->NodePosition(startNodeIndex, N1) || !topology->NodePosition(endNodeIndex, N2)) {
+            return false;
+        }
+        topology->BearingDirections(startNodeIndex, startDirections);
+        topology->BearingDirections(endNodeIndex, endDirections);
+        return true;
+    }
+
+    CartesianNodeVector c1 = node_1.node.GetCartesianNodeVector();
+    CartesianNodeVector c2 = node_2.node.GetCartesianNodeVector();
+    N1 = c1.cartesianCoords;
+    N2 = c2.cartesianCoords;
+    // Equ(4): Vi = Bi ⊗ Fi (BearingVector에 캐시된 값 사용)
+    for (const auto& bearing : node_1.bearings) startDirections.push_back(bearing.getWeightedDirection());
+    for (const auto& bearing : node_2.bearings) endDirections.push_back(bearing.getWeightedDirection());
+    return true;
+}
+
 // Calculate control points based on the equations
+// 모든 배열은 clear 후 재사용하므로 bearing 개수가 같으면 heap 할당이 없다.
 void LinerSegment::calculateControlPoints() {
+    PROFILE_SCOPE("LinerSegment::calculateControlPoints");
     controlPoints.clear();
 
+    Vector3 P0, Pn;
+    if (!gatherEndpoints(P0, Pn)) {
+        return; // 참조하는 node가 삭제됨: control point 없음
+    }
+    controlPoints.reserve(startDirections.size() + endDirections.size() + 3);
+
     // Equ(9): P0 = N1
-    CartesianNodeVector N1 = node_1.node.GetCartesianNodeVector();
-    Vector3 P0(N1.cartesianCoords.x, N1.cartesianCoords.y, N1.cartesianCoords.z);
     controlPoints.push_back(P0);
 
     // Equ(10): Pi = N1 + Ci, 1 ≤ i ≤ D1
-    int D1 = node_1.bearings.size();
-    std::vector<Vector3> C_list_1; // 노드 1의 Ci 리스트
-
-    for (int i = 0; i < D1; ++i) {
-        Vector3 Ci;
-        // Calculate Ci using Equ(4) and Equ(5)
-        float bx, by, bz;
-        node_1.bearings[i].calculateBearingVector(bx, by, bz);
-        BearingVectorForce Fi = node_1.bearings[i].getForce();
-        Vector3 Bi(bx, by, bz);
-        Vector3 FiVec(Fi.Force.x, Fi.Force.y, Fi.Force.z); // 수정됨
-
-        // Equ(4): Vi = Bi ⊗ Fi (성분별 곱셈)
-        Vector3 Vi = hadamardProduct(Bi, FiVec); // Vi = Bi ⊗ Fi
-
-        // Equ(5): Ci = Vi (d_{s,i}는 1로 가정)
-        Ci = Vi;
-        C_list_1.push_back(Ci);
-
+    // Equ(5): Ci = Vi (d_{s,i}는 1로 가정)
+    for (const Vector3& Ci : startDirections) {
         Vector3 Pi = P0 + Ci;
         controlPoints.push_back(Pi);
     }
 
-    // Equ(13): Pn = N2
-    CartesianNodeVector N2 = node_2.node.GetCartesianNodeVector();
-    Vector3 Pn(N2.cartesianCoords.x, N2.cartesianCoords.y, N2.cartesianCoords.z); // 수정됨
-
     // Equ(11): P_{D1+1} = α(N1 + C_{D1}) + (1 - α)(N2 - C_{1})
-    Vector3 C_D1 = C_list_1.back(); // 노드 1의 마지막 Ci
-    Vector3 C_1_D2; // 노드 2의 첫 번째 Ci
-
-    // 노드 2의 첫 번째 Ci 계산
-    if (node_2.bearings.size() > 0) { // 안전성 추가
-        // Calculate Ci using Equ(4) and Equ(5)
-        float bx, by, bz;
-        node_2.bearings[0].calculateBearingVector(bx, by, bz);
-        BearingVectorForce Fi = node_2.bearings[0].getForce();
-        Vector3 Bi(bx, by, bz);
-        Vector3 FiVec(Fi.Force.x, Fi.Force.y, Fi.Force.z); // 수정됨
-        C_1_D2 = hadamardProduct(Bi, FiVec); // Vi = Bi ⊗ Fi
-    } else {
-        C_1_D2 = Vector3(0.0f, 0.0f, 0.0f); // 기본값 설정
-    }
+    // 노드 1의 마지막 Ci (bearing이 없으면 0)
+    Vector3 C_D1 = startDirections.empty() ? Vector3(0.0f, 0.0f, 0.0f) : startDirections.back();
+    // 노드 2의 첫 번째 Ci (bearing이 없으면 0)
+    Vector3 C_1_D2 = endDirections.empty() ? Vector3(0.0f, 0.0f, 0.0f) : endDirections.front();
 
     Vector3 PD1plus1 = alpha * (P0 + C_D1) + (1.0f - alpha) * (Pn - C_1_D2);
     controlPoints.push_back(PD1plus1);
 
     // Equ(12): P_{D1+1+j} = N2 - C_{j}, 1 ≤ j ≤ D2
-    int D2 = node_2.bearings.size();
-    for (int j = 0; j < D2; ++j) {
-        Vector3 Ci;
-        // Calculate Ci using Equ(4) and Equ(5)
-        float bx, by, bz;
-        node_2.bearings[j].calculateBearingVector(bx, by, bz);
-        BearingVectorForce Fi = node_2.bearings[j].getForce();
-        Vector3 Bi(bx, by, bz);
-        Vector3 FiVec(Fi.Force.x, Fi.Force.y, Fi.Force.z); // 수정됨
-        Vector3 Vi = hadamardProduct(Bi, FiVec); // Vi = Bi ⊗ Fi
-        Ci = Vi; // d_{s,i}는 1로 가정
-
+    for (const Vector3& Ci : endDirections) {
         Vector3 Pi = Pn - Ci;
         controlPoints.push_back(Pi);
     }
@@ -111,47 +157,121 @@ void LinerSegment::calculateControlPoints() {
     // Equ(13): Pn = N2
     controlPoints.push_back(Pn);
 
-    // 컨트롤 포인트 출력 (디버깅 목적)
-    for (size_t i = 0; i < controlPoints.size(); ++i) {
-        Vector3 cp = controlPoints[i];
-        std::cout << "Control Point " << i << ": (" << cp.x << ", " << cp.y << ", " << cp.z << ")" << std::endl;
-    }
+    TRACE_DEBUG("LinerSegment %d-%d: %zu control points, P0 (%g, %g, %g), Pn (%g, %g, %g)",
+                startNodeIndex, endNodeIndex, controlPoints.size(), P0.x, P0.y, P0.z, Pn.x, Pn.y, Pn.z);
 }
 
 // Calculate Bezier curve based on control points
+// evaluator에 따라 Equ(8)을 계산하는 방식을 선택
 void LinerSegment::calculateBezierCurve() {
-    sampledPoints.clear();
-    int n = controlPoints.size() - 1;
-    int sampleCount = static_cast<int>(LevelOfDetail);
+    PROFILE_SCOPE("LinerSegment::calculateBezierCurve");
+    int n = static_cast<int>(controlPoints.size()) - 1;
 
-    for (int i = 0; i <= sampleCount; ++i) {
-        float t = static_cast<float>(i) / sampleCount;
-        Vector3 Bt(0, 0, 0);
-        for (int j = 0; j <= n; ++j) {
-            int coeff = binomialCoefficient(n, j);
-            float term = coeff * pow(1 - t, n - j) * pow(t, j);
-            Bt = Bt + term * controlPoints[j];
-        }
-        sampledPoints.push_back(Bt);
+    // Adaptive: 샘플 개수 대신 errorTolerance로 밀도 결정
+    if (samplingMode == SamplingMode::Adaptive) {
+        BezierSampler::SampleAdaptive(controlPoints.data(), n, errorTolerance, sampledPoints, adaptiveScratch);
+        return;
     }
-}
 
-// Compute binomial coefficient
-int LinerSegment::binomialCoefficient(int n, int k) {
-    if (k > n) return 0;
-    if (k == 0 || k == n) return 1;
-    int res = 1;
-    for (int i = 1; i <= k; ++i) {
-        res *= n - (k - i);
-        res /= i;
+    int sampleCount = static_cast<int>(LevelOfDetail);
+    if (n < 0 || sampleCount < 1) {
+        sampledPoints.clear();
+        return;
+    }
+    sampledPoints.resize(static_cast<std::size_t>(sampleCount) + 1);
+
+    switch (evaluator) {
+    case BezierEvaluator::ForwardDifference:
+        BezierSampler::SampleForwardDifference(controlPoints.data(), n, sampleCount, sampledPoints.data(), differenceScratch);
+        break;
+    case BezierEvaluator::DeCasteljau:
+        BezierSampler::SampleDeCasteljau(controlPoints.data(), n, sampleCount, sampledPoints.data(), casteljauScratch);
+        break;
+    case BezierEvaluator::PiecewiseCubic:
+        // 높은 차수의 곡선을 3차 조각으로 변환한 뒤 조각 단위로 O(1) 샘플링
+        BezierSampler::BuildCubicChain(controlPoints.data(), n, errorTolerance, cubicChain, cubicScratch);
+        BezierSampler::SampleCubicChain(cubicChain, sampleCount, sampledPoints.data());
+        break;
+    case BezierEvaluator::BernsteinTable:
+    default:
+        // 공유 basis 행렬 × control points, (degree, LOD)가 바뀐 경우에만 cache에서 다시 조회
+        if (!basis || basis->getDegree() != n || basis->getSampleCount() != sampleCount) {
+            basis = BernsteinBasisCache::Get(n, sampleCount);
+        }
+        basis->Evaluate(controlPoints.data(), sampledPoints.data());
+        break;
     }
-    return res;
 }
 
 // Public function to sample Bezier curve
+// 같은 bearing 개수/LOD/evaluator로 다시 호출하면 heap 할당 없이 이전 버퍼를 재사용한다.
 void LinerSegment::SamplingBezierCurve() {
     calculateControlPoints();
     calculateBezierCurve();
+    dirty = false;
+}
+
+// node 교체 (양 끝이 같은 node이면 둘 다 교체)
+bool LinerSegment::ReplaceNode(int nodeIndex, const NodeVector& node) {
+    bool changed = false;
+    if (startNodeIndex == nodeIndex) {
+        if (!topology) node_1.node = node;
+        changed = true;
+    }
+    if (endNodeIndex == nodeIndex) {
+        if (!topology) node_2.node = node;
+        changed = true;
+    }
+    dirty = dirty || changed;
+    return changed;
+}
+
+// bearing 교체 (nodeIndex, depth가 같은 bearing)
+bool LinerSegment::ReplaceBearing(int nodeIndex, int depth, const BearingVector& bearing) {
+    if (topology) {
+        bool changed = startNodeIndex == nodeIndex || endNodeIndex == nodeIndex;
+        dirty = dirty || changed;
+        return changed;
+    }
+    bool changed = false;
+    for (NodeVectorWithBearing* end : {&node_1, &node_2}) {
+        for (auto& b : end->bearings) {
+            if (b.getNodeIndex() == nodeIndex && b.getDepth() == depth) {
+                b = bearing;
+                changed = true;
+            }
+        }
+    }
+    dirty = dirty || changed;
+    return changed;
+}
+
+// bearing 삭제
+bool LinerSegment::RemoveBearing(int nodeIndex, int depth) {
+    if (topology) {
+        bool changed = startNodeIndex == nodeIndex || endNodeIndex == nodeIndex;
+        dirty = dirty || changed;
+        return changed;
+    }
+    bool changed = false;
+    for (NodeVectorWithBearing* end : {&node_1, &node_2}) {
+        auto& bearings = end->bearings;
+        for (auto it = bearings.begin(); it != bearings.end();) {
+            if (it->getNodeIndex() == nodeIndex && it->getDepth() == depth) {
+                it = bearings.erase(it);
+                changed = true;
+            } else {
+                ++it;
+            }
+        }
+    }
+    dirty = dirty || changed;
+    return changed;
+}
+
+// 임의의 t 배열에 대한 위치, 도함수, 곡률 계산
+void LinerSegment::EvaluateFrames(const float* t, std::size_t count, BezierFrameBatch& out) const {
+    BezierSampler::EvaluateFrames(controlPoints.data(), static_cast<int>(controlPoints.size()) - 1, t, count, out);
 }
 
 // Placeholder for SamplingVertex (depends on specific implementation)
@@ -164,8 +284,8 @@ void LinerSegment::SamplingVertex() {
 LinerSegmentData LinerSegment::ReturnLinerSegmentData() const {
     LinerSegmentData data;
     data.LinerBufferIndex = 0; // 필요한 경우 적절한 값으로 설정
-    data.NodeStart = node_1.node;
-    data.NodeEnd = node_2.node;
+    data.NodeStart = topology ? topology->Node(startNodeIndex) : node_1.node;
+    data.NodeEnd = topology ? topology->Node(endNodeIndex) : node_2.node;
     data.LevelOfDetail = LevelOfDetail;
     data.alpha = alpha;
     return data;
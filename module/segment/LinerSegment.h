@@ -30,15 +30,37 @@
 #include "Vector3.h"
 #include "NodeVector.h"
 #include "BearingVector.h"
+#include "BernsteinBasis.h"
+#include "BezierSampler.h"
+#include "SceneArena.h"
+#include <memory>
 #include <vector>
 #include <cmath>
-#include <iostream> // 디버깅을 위한 헤더 추가
 
 struct NodeVectorWithBearing {
     NodeVector node;
     std::vector<BearingVector> bearings;
 };
 
+/**
+ * @brief LinerSegment가 node/bearing 데이터를 읽어 오는 공유 topology interface.
+ *        node는 index(i_n)로 참조하며, 데이터는 구현체(AttributesManager 등) 한 곳에만 존재한다.
+ *        구현체는 SamplingBezierCurve가 여러 스레드에서 동시에 호출될 때 const 조회를 허용해야 한다.
+ */
+class SegmentTopologySource {
+public:
+    virtual ~SegmentTopologySource() = default;
+
+    // node의 Cartesian 좌표 (node가 없으면 false)
+    virtual bool NodePosition(int nodeIndex, Vector3& position) const = 0;
+
+    // node에 연결된 bearing의 B ⊗ F를 순서대로 directions 뒤에 추가
+    virtual void BearingDirections(int nodeIndex, ScenePointVector& directions) const = 0;
+
+    // node 전체 값 (node가 없으면 기본값)
+    virtual NodeVector Node(int nodeIndex) const = 0;
+};
+
 struct LinerSegmentData {
     int LinerBufferIndex;
     NodeVector NodeStart;
@@ -50,35 +72,93 @@ struct LinerSegmentData {
 class LinerSegment {
 private:
     float LevelOfDetail;
-    NodeVectorWithBearing node_1;
+    int startNodeIndex; // 양 끝 node index (i_n)
+    int endNodeIndex;
+    const SegmentTopologySource* topology; // 공유 topology (nullptr이면 아래 복사본 사용)
+    NodeVectorWithBearing node_1; // topology에 연결되지 않은 경우의 node/bearing 복사본
     NodeVectorWithBearing node_2;
-    std::vector<Vector3> controlPoints;
-    std::vector<Vector3> sampledPoints;
+    ScenePointVector startDirections; // 계산용: 양 끝 node bearing의 B ⊗ F
+    ScenePointVector endDirections;
+    ScenePointVector controlPoints;
+    ScenePointVector sampledPoints;
     float alpha; // Blending factor for control points
     float L_min, L_max; // Min and Max lengths for Equ(6) and Equ(7)
+    std::shared_ptr<const BernsteinBasis> basis; // 마지막으로 사용한 (degree, LOD) basis 행렬
+    BezierEvaluator evaluator; // 샘플링 방식
+    SamplingMode samplingMode; // Uniform: LevelOfDetail 개 구간, Adaptive: errorTolerance 기준 분할
+    float errorTolerance;      // Adaptive 모드 및 PiecewiseCubic 변환의 구간당 허용 오차 (error budget)
+    BezierAdaptiveScratch adaptiveScratch; // Adaptive 작업 버퍼
+    std::vector<Vector3> casteljauScratch; // DeCasteljau 작업 버퍼
+    std::vector<double> differenceScratch; // ForwardDifference 작업 버퍼
+    BezierCubicChain cubicChain;           // PiecewiseCubic: control point가 바뀔 때마다 다시 만듦
+    BezierCubicScratch cubicScratch;       // PiecewiseCubic 작업 버퍼
+    bool dirty; // node/bearing 복사본이 바뀌어 다시 샘플링이 필요한지 여부
 
     // Helper functions
+    bool gatherEndpoints(Vector3& N1, Vector3& N2);
     void calculateControlPoints();
     void calculateBezierCurve();
-    int binomialCoefficient(int n, int k);
 
 public:
-    // Constructor
+    // Constructor (node/bearing 복사본 사용)
     LinerSegment(const NodeVectorWithBearing& n1, const NodeVectorWithBearing& n2, float lod, float alphaVal = 0.5f);
 
+    // Constructor (공유 topology에서 node index로 참조, source는 segment보다 오래 살아야 함)
+    LinerSegment(int startNode, int endNode, const SegmentTopologySource& source, float lod, float alphaVal = 0.5f);
+
+    // Constructor (공유 topology 참조, 저장된 control point / sample을 그대로 사용하며 샘플링하지 않음)
+    LinerSegment(int startNode, int endNode, const SegmentTopologySource& source, float lod, float alphaVal,
+                 ScenePointVector storedControlPoints, ScenePointVector storedSampledPoints);
+
+    // 공유 topology에 연결하고 node/bearing 복사본을 버림 (nullptr이면 연결만 해제, 복사본은 복구되지 않음)
+    // 샘플은 다시 계산하지 않으므로 필요하면 dirty로 표시된 뒤 SamplingBezierCurve()를 호출
+    void BindTopology(const SegmentTopologySource* source);
+    bool isBound() const { return topology != nullptr; }
+
+    // 복사본의 양 끝 node 좌표와 bearing B ⊗ F (순서 포함)가 source와 같은지 여부
+    // (같으면 BindTopology로 연결해도 샘플이 바뀌지 않음, 이미 연결된 segment는 false)
+    bool MatchesTopology(const SegmentTopologySource& source) const;
+
+    // 점 배열을 allocator(scene arena 등)로 옮김. 이 segment를 복사한 segment는 일반 heap을 사용
+    void setAllocator(const ArenaAllocator<Vector3>& allocator);
+    const SegmentTopologySource* getTopology() const { return topology; }
+
     // Functions to generate the Bezier curve and sample vertices
     void SamplingBezierCurve();
     void SamplingVertex();
     LinerSegmentData ReturnLinerSegmentData() const; // 함수 선언
 
+    // 의존성 갱신: 해당 node/bearing을 참조하면 dirty로 표시 (변경 여부 반환)
+    // topology에 연결되지 않은 경우에는 복사본도 교체/삭제한다.
+    // 다시 샘플링은 SamplingBezierCurve() 호출 시 수행
+    bool ReplaceNode(int nodeIndex, const NodeVector& node);
+    bool ReplaceBearing(int nodeIndex, int depth, const BearingVector& bearing);
+    bool RemoveBearing(int nodeIndex, int depth);
+    bool isDirty() const { return dirty; }
+    void markDirty() { dirty = true; }
+    // 현재 샘플이 topology와 일치함을 아는 경우에만 사용 (AttributesManager::CreateSampledLinerSegment)
+    void clearDirty() { dirty = false; }
+
+    // 임의의 t 배열에서 B(t), B'(t), B''(t), κ(t)를 한 번에 계산 (out은 호출 간 재사용)
+    void EvaluateFrames(const float* t, std::size_t count, BezierFrameBatch& out) const;
+
     // Getters
-    const std::vector<Vector3>& getSampledPoints() const { return sampledPoints; }
-    const std::vector<Vector3>& getControlPoints() const { return controlPoints; }
+    const ScenePointVector& getSampledPoints() const { return sampledPoints; }
+    const ScenePointVector& getControlPoints() const { return controlPoints; }
+    const BezierCubicChain& getCubicChain() const { return cubicChain; } // PiecewiseCubic일 때만 유효
     float getLevelOfDetail() const { return LevelOfDetail; }
     float getAlpha() const { return alpha; }
+    int getStartNodeIndex() const { return startNodeIndex; }
+    int getEndNodeIndex() const { return endNodeIndex; }
+    BezierEvaluator getEvaluator() const { return evaluator; }
+    SamplingMode getSamplingMode() const { return samplingMode; }
+    float getErrorTolerance() const { return errorTolerance; }
 
     // Setters
     void setLevelOfDetail(float lod) { LevelOfDetail = lod; }
+    void setEvaluator(BezierEvaluator method) { evaluator = method; } // 다음 SamplingBezierCurve()부터 적용
+    void setSamplingMode(SamplingMode mode) { samplingMode = mode; }  // 다음 SamplingBezierCurve()부터 적용
+    void setErrorTolerance(float tolerance) { errorTolerance = tolerance; }
 };
 
 #endif // LINERSEGMENT_H
@@ -11,55 +11,62 @@
 #include <cmath>
 
 // Constructor implementation
-BearingVector::BearingVector(int index, int depth, const NodeVector& node, float phi_i, float theta_i, float f_x, float f_y, float f_z)
+BearingVector::BearingVector(int index, int depth, float phi_i, float theta_i, float f_x, float f_y, float f_z)
 {
-    // Initialize spherical bearing vector
+    // Initialize spherical bearing vector (node는 index로만 참조)
     sphericalBearing.i = index;
     sphericalBearing.d = depth;
-    sphericalBearing.node = node;
     sphericalBearing.angularAcceleration.phi_i = phi_i;
     sphericalBearing.angularAcceleration.theta_i = theta_i;
     sphericalBearing.force.Force = Vector3(f_x, f_y, f_z);
 
-    // Initialize Cartesian bearing vector by converting spherical to Cartesian
-    SphericalVector sv(1.0f, theta_i, phi_i); // Assuming unit vector
+    // Initialize Cartesian bearing vector and B ⊗ F
+    refreshDerived();
+}
+
+// Constructor kept for existing callers (node is not stored)
+BearingVector::BearingVector(int index, int depth, const NodeVector& /*node*/, float phi_i, float theta_i, float f_x, float f_y, float f_z)
+    : BearingVector(index, depth, phi_i, theta_i, f_x, f_y, f_z) {}
+
+// Recompute the cached Cartesian bearing vector and B ⊗ F from the spherical data
+void BearingVector::refreshDerived() {
+    // Convert spherical to Cartesian (unit vector)
+    SphericalVector sv(1.0f, sphericalBearing.angularAcceleration.theta_i, sphericalBearing.angularAcceleration.phi_i);
     CartesianVector cv = CoordinateConverter::sphericalToCartesian(sv);
-    cartesianBearing = CartesianBearingVector(index, depth, cv.x, cv.y, cv.z, f_x, f_y, f_z);
+    const Vector3& F = sphericalBearing.force.Force;
+    cartesianBearing = CartesianBearingVector(sphericalBearing.i, sphericalBearing.d, cv.x, cv.y, cv.z, F.x, F.y, F.z);
+
+    // Equ(4): B ⊗ F (성분별 곱셈)
+    weightedDirection = Vector3(cv.x * F.x, cv.y * F.y, cv.z * F.z);
 }
 
 // Function to calculate the Cartesian components of the Bearing Vector (unit vector) based on the Node Vector
 void BearingVector::calculateBearingVector(float& x, float& y, float& z) const {
-    // Assuming bearing vector is a unit vector in the direction specified by spherical angles
-    float r = 1.0f; // Unit vector
-    float theta = sphericalBearing.angularAcceleration.theta_i;
-    float phi = sphericalBearing.angularAcceleration.phi_i;
-
-    x = r * sin(phi) * cos(theta);
-    y = r * sin(phi) * sin(theta);
-    z = r * cos(phi);
+    // 생성/수정 시 계산해 둔 단위 벡터 사용
+    x = cartesianBearing.cartesianCoords.x;
+    y = cartesianBearing.cartesianCoords.y;
+    z = cartesianBearing.cartesianCoords.z;
 }
 
 // Function to convert the spherical bearing vector to a Cartesian bearing vector
 CartesianBearingVector BearingVector::convertToCartesianBearingVector() const {
-    // Use CoordinateConverter to convert spherical to Cartesian
-    SphericalVector sv(1.0f, sphericalBearing.angularAcceleration.theta_i, sphericalBearing.angularAcceleration.phi_i);
-    CartesianVector cv = CoordinateConverter::sphericalToCartesian(sv);
+    return cartesianBearing;
+}
 
-    // Initialize and return CartesianBearingVector
-    return CartesianBearingVector(
-        sphericalBearing.i, 
-        sphericalBearing.d, 
-        cv.x, 
-        cv.y, 
-        cv.z, 
-        sphericalBearing.force.Force.x, 
-        sphericalBearing.force.Force.y, 
-        sphericalBearing.force.Force.z
-    );
+// Setters that keep the cached state in sync
+void BearingVector::setAngles(float phi_i, float theta_i) {
+    sphericalBearing.angularAcceleration.phi_i = phi_i;
+    sphericalBearing.angularAcceleration.theta_i = theta_i;
+    refreshDerived();
+}
+
+void BearingVector::setForce(float f_x, float f_y, float f_z) {
+    sphericalBearing.force.Force = Vector3(f_x, f_y, f_z);
+    refreshDerived();
 }
 
-// Function to convert the Cartesian bearing vector back to spherical coordinates (using node vector)
-SphericalBearingVectorStruct BearingVector::convertToSphericalBearingVector(const CartesianBearingVector& cartesian, const NodeVector& node) const {
+// Function to convert the Cartesian bearing vector back to spherical coordinates
+SphericalBearingVectorStruct BearingVector::convertToSphericalBearingVector(const CartesianBearingVector& cartesian) const {
     // Use CoordinateConverter to convert Cartesian to spherical
     SphericalVector sv = CoordinateConverter::cartesianToSpherical(
         CartesianVector(cartesian.cartesianCoords.x, cartesian.cartesianCoords.y, cartesian.cartesianCoords.z)
@@ -69,7 +76,6 @@ SphericalBearingVectorStruct BearingVector::convertToSphericalBearingVector(cons
     SphericalBearingVectorStruct sbv;
     sbv.i = cartesian.i;
     sbv.d = cartesian.d;
-    sbv.node = node;
     sbv.angularAcceleration.phi_i = sv.phi;
     sbv.angularAcceleration.theta_i = sv.theta;
     sbv.force.Force = cartesian.force.Force;
@@ -77,6 +83,10 @@ SphericalBearingVectorStruct BearingVector::convertToSphericalBearingVector(cons
     return sbv;
 }
 
+SphericalBearingVectorStruct BearingVector::convertToSphericalBearingVector(const CartesianBearingVector& cartesian, const NodeVector& /*node*/) const {
+    return convertToSphericalBearingVector(cartesian);
+}
+
 // Function to get the force vector components
 BearingVectorForce BearingVector::getForce() const {
     return sphericalBearing.force;
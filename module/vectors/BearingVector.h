@@ -24,11 +24,11 @@ struct BearingVectorAngularAcceleration {
 
 /**
  * @brief Structure to hold full spherical bearing vector data.
+ *        The owning node is referenced by index i only; node data lives in the node store.
  */
 struct SphericalBearingVectorStruct {
     int i; // Node vector index
     int d; // Bearing vector depth (vector depth)
-    NodeVector node;  // Node vector
     BearingVectorAngularAcceleration angularAcceleration;  // Angular acceleration (φ, θ)
     BearingVectorForce force;  // Force vector (Fx, Fy, Fz)
 };
@@ -67,7 +67,11 @@ struct CartesianBearingVector {
 class BearingVector {
 private:
     SphericalBearingVectorStruct sphericalBearing;
-    CartesianBearingVector cartesianBearing;
+    CartesianBearingVector cartesianBearing; // 단위 방향 벡터 B와 힘 F (각도/힘 변경 시 갱신)
+    Vector3 weightedDirection;               // Equ(4)의 B ⊗ F (각도/힘 변경 시 갱신)
+
+    // 각도 또는 힘이 바뀐 뒤 cartesianBearing, weightedDirection을 다시 계산
+    void refreshDerived();
 
 public:
     /**
@@ -75,7 +79,21 @@ public:
      * 
      * @param index Node vector index.
      * @param depth Bearing vector depth.
-     * @param node NodeVector instance.
+     * @param phi_i Polar angle (φ).
+     * @param theta_i Azimuthal angle (θ).
+     * @param f_x X-component of the force vector.
+     * @param f_y Y-component of the force vector.
+     * @param f_z Z-component of the force vector.
+     */
+    BearingVector(int index, int depth, float phi_i, float theta_i, float f_x, float f_y, float f_z);
+
+    /**
+     * @brief Constructor for BearingVector (kept for existing callers).
+     *        The node is not stored; the bearing refers to its node by index only.
+     * 
+     * @param index Node vector index.
+     * @param depth Bearing vector depth.
+     * @param node NodeVector instance (unused).
      * @param phi_i Polar angle (φ).
      * @param theta_i Azimuthal angle (θ).
      * @param f_x X-component of the force vector.
@@ -86,6 +104,7 @@ public:
 
     /**
      * @brief Function to calculate the Cartesian components of the Bearing Vector (unit vector) based on the Node Vector.
+     *        Returns the cached unit direction; no trigonometry is evaluated.
      * 
      * @param x Reference to store the x-component.
      * @param y Reference to store the y-component.
@@ -95,16 +114,63 @@ public:
 
     /**
      * @brief Function to convert the spherical bearing vector to a Cartesian bearing vector.
+     *        Returns a copy of the cached Cartesian bearing vector.
      * 
      * @return CartesianBearingVector Converted Cartesian bearing vector.
      */
     CartesianBearingVector convertToCartesianBearingVector() const;
 
     /**
-     * @brief Function to convert the Cartesian bearing vector back to spherical coordinates (using node vector).
+     * @brief Cached Cartesian bearing vector (unit direction and force).
+     * 
+     * @return const CartesianBearingVector& Cached Cartesian bearing vector.
+     */
+    const CartesianBearingVector& getCartesianBearingVector() const { return cartesianBearing; }
+
+    /**
+     * @brief Cached Cartesian unit direction B.
+     * 
+     * @return const Vector3& Unit direction.
+     */
+    const Vector3& getUnitDirection() const { return cartesianBearing.cartesianCoords; }
+
+    /**
+     * @brief Cached Hadamard product B ⊗ F (Equ 4 of LinerSegment).
+     * 
+     * @return const Vector3& Component-wise product of the unit direction and the force.
+     */
+    const Vector3& getWeightedDirection() const { return weightedDirection; }
+
+    /**
+     * @brief Setter for the angles. Updates the cached direction and B ⊗ F.
+     * 
+     * @param phi_i Polar angle (φ).
+     * @param theta_i Azimuthal angle (θ).
+     */
+    void setAngles(float phi_i, float theta_i);
+
+    /**
+     * @brief Setter for the force vector. Updates the cached B ⊗ F.
+     * 
+     * @param f_x X-component of the force vector.
+     * @param f_y Y-component of the force vector.
+     * @param f_z Z-component of the force vector.
+     */
+    void setForce(float f_x, float f_y, float f_z);
+
+    /**
+     * @brief Function to convert the Cartesian bearing vector back to spherical coordinates.
+     * 
+     * @param cartesian Cartesian bearing vector to convert.
+     * @return SphericalBearingVectorStruct Converted spherical bearing vector.
+     */
+    SphericalBearingVectorStruct convertToSphericalBearingVector(const CartesianBearingVector& cartesian) const;
+
+    /**
+     * @brief Same as above (kept for existing callers). The node is not used.
      * 
      * @param cartesian Cartesian bearing vector to convert.
-     * @param node NodeVector instance for reference.
+     * @param node NodeVector instance (unused).
      * @return SphericalBearingVectorStruct Converted spherical bearing vector.
      */
     SphericalBearingVectorStruct convertToSphericalBearingVector(const CartesianBearingVector& cartesian, const NodeVector& node) const;
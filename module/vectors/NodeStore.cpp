@@ -0,0 +1,234 @@
+/* NodeStore.cpp
+ * Linked file NodeStore.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * Structure-of-Arrays 형태의 NodeVector 저장소 구현
+ */
+
+#include "NodeStore.h"
+#include "CoordinateConverter.h"
+#include <algorithm>
+
+namespace {
+// n을 SIMD 폭의 배수로 올림
+std::size_t RoundUpToLane(std::size_t n) {
+    return (n + kNodeStoreLaneWidth - 1) / kNodeStoreLaneWidth * kNodeStoreLaneWidth;
+}
+}
+
+// 기본 생성자
+NodeStore::NodeStore() : count(0), pendingCount(0) {}
+
+// 최소 n개의 NodeVector를 담을 수 있도록 용량 확보
+void NodeStore::reserve(std::size_t n) {
+    std::size_t padded = RoundUpToLane(n);
+    indices.reserve(padded);
+    x.reserve(padded);
+    y.reserve(padded);
+    z.reserve(padded);
+    r.reserve(padded);
+    theta.reserve(padded);
+    phi.reserve(padded);
+    pending.reserve(padded);
+}
+
+// 모든 NodeVector 삭제 (용량은 유지)
+void NodeStore::clear() {
+    count = 0;
+    pendingCount = 0;
+    indices.clear();
+    x.clear();
+    y.clear();
+    z.clear();
+    r.clear();
+    theta.clear();
+    phi.clear();
+    pending.clear();
+}
+
+// 패딩 포함 배열 크기 확장 (새 영역은 0으로 채워짐)
+void NodeStore::growTo(std::size_t n) {
+    std::size_t padded = RoundUpToLane(n);
+    if (padded <= indices.size()) return;
+    indices.resize(padded, 0);
+    x.resize(padded, 0.0f);
+    y.resize(padded, 0.0f);
+    z.resize(padded, 0.0f);
+    r.resize(padded, 0.0f);
+    theta.resize(padded, 0.0f);
+    phi.resize(padded, 0.0f);
+    pending.resize(padded, PendingNone);
+}
+
+// pos 위치의 변환 대기 상태 변경 (대기 node 수 유지)
+void NodeStore::setPending(std::size_t pos, PendingConversion state) {
+    if (pending[pos] != PendingNone) --pendingCount;
+    if (state != PendingNone) ++pendingCount;
+    pending[pos] = state;
+}
+
+// pos 위치에 NodeVector 값 기록
+// 파생 형태가 계산되어 있지 않으면 (Lazy) 기준 형태만 기록하고 나머지는 첫 읽기에서 batch로 계산
+void NodeStore::write(std::size_t pos, const NodeVector& node) {
+    if (!node.HasDerivedForm()) {
+        if (node.GetAuthoritativeForm() == NodeVectorForm::Spherical) {
+            SphericalNodeVector snv = node.GetSphericalNodeVector();
+            indices[pos] = snv.i_n;
+            r[pos] = snv.sphericalCoords.x;
+            theta[pos] = snv.sphericalCoords.y;
+            phi[pos] = snv.sphericalCoords.z;
+            x[pos] = y[pos] = z[pos] = 0.0f;
+            setPending(pos, PendingCartesian);
+        } else {
+            CartesianNodeVector cnv = node.GetCartesianNodeVector();
+            indices[pos] = cnv.i_n;
+            x[pos] = cnv.cartesianCoords.x;
+            y[pos] = cnv.cartesianCoords.y;
+            z[pos] = cnv.cartesianCoords.z;
+            r[pos] = theta[pos] = phi[pos] = 0.0f;
+            setPending(pos, PendingSpherical);
+        }
+        return;
+    }
+    SphericalNodeVector snv = node.GetSphericalNodeVector();
+    CartesianNodeVector cnv = node.GetCartesianNodeVector();
+    indices[pos] = snv.i_n;
+    x[pos] = cnv.cartesianCoords.x;
+    y[pos] = cnv.cartesianCoords.y;
+    z[pos] = cnv.cartesianCoords.z;
+    r[pos] = snv.sphericalCoords.x;
+    theta[pos] = snv.sphericalCoords.y;
+    phi[pos] = snv.sphericalCoords.z;
+    setPending(pos, PendingNone);
+}
+
+// 변환 대기 node를 같은 상태가 이어지는 구간 단위로 batch 변환
+void NodeStore::convertPending() {
+    if (pendingCount == 0) return;
+    std::size_t pos = 0;
+    while (pos < count) {
+        unsigned char state = pending[pos];
+        if (state == PendingNone) {
+            ++pos;
+            continue;
+        }
+        std::size_t end = pos + 1;
+        while (end < count && pending[end] == state) ++end;
+        std::size_t n = end - pos;
+        if (state == PendingCartesian) {
+            CoordinateConverter::sphericalToCartesian(r.data() + pos, theta.data() + pos, phi.data() + pos,
+                                                      x.data() + pos, y.data() + pos, z.data() + pos, n);
+        } else {
+            CoordinateConverter::cartesianToSpherical(x.data() + pos, y.data() + pos, z.data() + pos,
+                                                      r.data() + pos, theta.data() + pos, phi.data() + pos, n);
+        }
+        std::fill_n(pending.begin() + pos, n, static_cast<unsigned char>(PendingNone));
+        pos = end;
+    }
+    pendingCount = 0;
+}
+
+// NodeVector 추가
+void NodeStore::push_back(const NodeVector& node) {
+    growTo(count + 1);
+    write(count, node);
+    ++count;
+}
+
+// 다른 NodeStore의 일부 범위 추가 (변환 대기 상태도 함께 복사)
+void NodeStore::append(const NodeStore& source, std::size_t first, std::size_t n) {
+    growTo(count + n);
+    std::copy_n(source.indices.begin() + first, n, indices.begin() + count);
+    std::copy_n(source.x.begin() + first, n, x.begin() + count);
+    std::copy_n(source.y.begin() + first, n, y.begin() + count);
+    std::copy_n(source.z.begin() + first, n, z.begin() + count);
+    std::copy_n(source.r.begin() + first, n, r.begin() + count);
+    std::copy_n(source.theta.begin() + first, n, theta.begin() + count);
+    std::copy_n(source.phi.begin() + first, n, phi.begin() + count);
+    std::copy_n(source.pending.begin() + first, n, pending.begin() + count);
+    if (source.pendingCount > 0) {
+        pendingCount += static_cast<std::size_t>(std::count_if(
+            pending.begin() + count, pending.begin() + count + n, [](unsigned char state) { return state != PendingNone; }));
+    }
+    count += n;
+}
+
+// NodeVector 교체
+void NodeStore::set(std::size_t pos, const NodeVector& node) {
+    write(pos, node);
+}
+
+// NodeVector 삭제 (뒤쪽 원소를 앞으로 당기고 마지막 칸은 0으로 패딩)
+void NodeStore::erase(std::size_t pos) {
+    setPending(pos, PendingNone);
+    for (std::size_t i = pos + 1; i < count; ++i) {
+        indices[i - 1] = indices[i];
+        x[i - 1] = x[i];
+        y[i - 1] = y[i];
+        z[i - 1] = z[i];
+        r[i - 1] = r[i];
+        theta[i - 1] = theta[i];
+        phi[i - 1] = phi[i];
+        pending[i - 1] = pending[i];
+    }
+    --count;
+    pending[count] = PendingNone;
+    indices[count] = 0;
+    x[count] = y[count] = z[count] = 0.0f;
+    r[count] = theta[count] = phi[count] = 0.0f;
+}
+
+// NodeVector 삭제 (마지막 원소를 pos로 옮기고 마지막 칸은 0으로 패딩)
+void NodeStore::swapErase(std::size_t pos) {
+    std::size_t last = count - 1;
+    setPending(pos, PendingNone);
+    if (pos != last) {
+        indices[pos] = indices[last];
+        x[pos] = x[last];
+        y[pos] = y[last];
+        z[pos] = z[last];
+        r[pos] = r[last];
+        theta[pos] = theta[last];
+        phi[pos] = phi[last];
+        pending[pos] = pending[last];
+    }
+    count = last;
+    pending[last] = PendingNone;
+    indices[last] = 0;
+    x[last] = y[last] = z[last] = 0.0f;
+    r[last] = theta[last] = phi[last] = 0.0f;
+}
+
+// 사용자 index(i_n)로 위치 검색
+std::size_t NodeStore::find(int index) const {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (indices[i] == index) return i;
+    }
+    return npos;
+}
+
+// 저장된 값으로 NodeVector 구성 (좌표 변환 없이 두 형태를 그대로 사용)
+// 변환 대기 node는 기준 형태만 가진 Lazy NodeVector (store는 바꾸지 않음)
+NodeVector NodeStore::operator[](std::size_t pos) const {
+    if (pending[pos] == PendingCartesian) {
+        return NodeVector(SphericalNodeVector(indices[pos], r[pos], theta[pos], phi[pos]), NodeConversionMode::Lazy);
+    }
+    if (pending[pos] == PendingSpherical) {
+        return NodeVector(CartesianNodeVector(indices[pos], x[pos], y[pos], z[pos]), NodeConversionMode::Lazy);
+    }
+    return NodeVector(SphericalNodeVector(indices[pos], r[pos], theta[pos], phi[pos]),
+                      CartesianNodeVector(indices[pos], x[pos], y[pos], z[pos]));
+}
+
+// Cartesian view 반환
+NodeCartesianView NodeStore::cartesian() const {
+    return NodeCartesianView{indices.data(), x.data(), y.data(), z.data(), count, indices.size()};
+}
+
+// Spherical view 반환
+NodeSphericalView NodeStore::spherical() const {
+    return NodeSphericalView{indices.data(), r.data(), theta.data(), phi.data(), count, indices.size()};
+}
@@ -0,0 +1,216 @@
+/* NodeStore.h
+ * Linked file NodeStore.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * Structure-of-Arrays 형태의 NodeVector 저장소
+ *
+ * NodeVector는 Spherical/Cartesian 두 형태를 모두 가지고 있어 배열로 저장하면
+ * Cartesian 좌표만 순회할 때도 두 배의 캐시 라인을 읽게 된다.
+ * NodeStore는 x/y/z, r/theta/phi, index를 각각 연속된 배열로 저장하고
+ * 모든 배열을 SIMD 폭(kNodeStoreLaneWidth)에 맞춰 정렬 및 패딩한다.
+ * 패딩 영역은 항상 0으로 채워져 있으므로 SIMD 커널이 꼬리 처리 없이 읽을 수 있다.
+ *
+ * 변환 지연 (NodeConversionMode::Lazy)
+ * 파생 형태가 아직 없는 NodeVector는 기준 형태만 기록하고 node마다 변환 대기 표시를 남긴다.
+ * 소유자 (수정하는 thread)가 convertPending()을 호출하면 대기 중인 node를
+ * CoordinateConverter batch 변환으로 한꺼번에 계산한다 (오차 한계는 CoordinateConverter.h 참고).
+ * const 접근자는 store를 바꾸지 않으므로 여러 스레드에서 동시에 읽을 수 있다.
+ * 대신 변환 전에는 cartesian() / spherical() view의 대기 node 파생 형태가 0이며 (isPending으로 확인),
+ * operator[]는 대기 node를 Lazy NodeVector로 반환한다.
+ */
+
+#ifndef NODESTORE_H
+#define NODESTORE_H
+
+#include "NodeVector.h"
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <vector>
+
+// SIMD 정렬 단위 (AVX2 기준 32 bytes = float 8개)
+constexpr std::size_t kNodeStoreAlignment = 32;
+constexpr std::size_t kNodeStoreLaneWidth = kNodeStoreAlignment / sizeof(float);
+
+/**
+ * @brief Alignment 바이트 경계에 맞춰 메모리를 할당하는 allocator.
+ */
+template <typename T, std::size_t Alignment>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T, kNodeStoreAlignment>>;
+
+/**
+ * @brief Cartesian 좌표 배열에 대한 읽기 전용 view.
+ *        size 이후 paddedSize까지의 값은 0이다.
+ */
+struct NodeCartesianView {
+    const int* index;
+    const float* x;
+    const float* y;
+    const float* z;
+    std::size_t size;
+    std::size_t paddedSize;
+};
+
+/**
+ * @brief Spherical 좌표 배열에 대한 읽기 전용 view.
+ *        size 이후 paddedSize까지의 값은 0이다.
+ */
+struct NodeSphericalView {
+    const int* index;
+    const float* r;
+    const float* theta;
+    const float* phi;
+    std::size_t size;
+    std::size_t paddedSize;
+};
+
+/**
+ * @brief NodeStore 클래스.
+ *        NodeVector를 SoA 형태로 저장하고 view 및 NodeVector 단위 접근을 제공.
+ */
+class NodeStore {
+public:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief NodeStore를 NodeVector 단위로 순회하기 위한 iterator.
+     *        역참조 시 저장된 값으로 NodeVector를 만들어 반환한다 (변환 계산 없음).
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = NodeVector;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = NodeVector;
+
+        const_iterator(const NodeStore* store = nullptr, std::size_t pos = 0) : store_(store), pos_(pos) {}
+
+        NodeVector operator*() const { return (*store_)[pos_]; }
+        NodeVector operator[](difference_type n) const { return (*store_)[pos_ + n]; }
+
+        const_iterator& operator++() { ++pos_; return *this; }
+        const_iterator operator++(int) { const_iterator tmp = *this; ++pos_; return tmp; }
+        const_iterator& operator--() { --pos_; return *this; }
+        const_iterator operator--(int) { const_iterator tmp = *this; --pos_; return tmp; }
+        const_iterator& operator+=(difference_type n) { pos_ += n; return *this; }
+        const_iterator& operator-=(difference_type n) { pos_ -= n; return *this; }
+        const_iterator operator+(difference_type n) const { return const_iterator(store_, pos_ + n); }
+        const_iterator operator-(difference_type n) const { return const_iterator(store_, pos_ - n); }
+        difference_type operator-(const const_iterator& other) const {
+            return static_cast<difference_type>(pos_) - static_cast<difference_type>(other.pos_);
+        }
+
+        bool operator==(const const_iterator& other) const { return pos_ == other.pos_; }
+        bool operator!=(const const_iterator& other) const { return pos_ != other.pos_; }
+        bool operator<(const const_iterator& other) const { return pos_ < other.pos_; }
+
+    private:
+        const NodeStore* store_;
+        std::size_t pos_;
+    };
+
+    NodeStore();
+
+    // 크기 관련 함수
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    std::size_t paddedSize() const { return indices.size(); }
+    void reserve(std::size_t n);
+    void clear();
+
+    // NodeVector를 끝에 추가
+    void push_back(const NodeVector& node);
+
+    // source의 [first, first + n) 범위를 끝에 추가 (배열 단위 복사)
+    void append(const NodeStore& source, std::size_t first, std::size_t n);
+
+    // pos 위치의 NodeVector를 교체
+    void set(std::size_t pos, const NodeVector& node);
+
+    // pos 위치의 NodeVector를 삭제 (순서 유지)
+    void erase(std::size_t pos);
+
+    // pos 위치의 NodeVector를 삭제 (마지막 원소를 pos로 옮김, O(1))
+    void swapErase(std::size_t pos);
+
+    // 사용자 index(i_n)로 위치 검색, 없으면 npos
+    std::size_t find(int index) const;
+
+    // NodeVector 단위 접근 (값으로 반환)
+    NodeVector operator[](std::size_t pos) const;
+    NodeVector back() const { return (*this)[count - 1]; }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, count); }
+
+    // SoA view 접근자 (변환 대기 node의 파생 형태는 convertPending 전까지 0)
+    NodeCartesianView cartesian() const;
+    NodeSphericalView spherical() const;
+    const int* indexData() const { return indices.data(); }
+
+    // 변환 대기 중인 node 수
+    std::size_t pendingConversions() const { return pendingCount; }
+
+    // pos 위치의 node가 변환 대기 중인지 여부
+    bool isPending(std::size_t pos) const { return pending[pos] != PendingNone; }
+
+    // 변환 대기 중인 node의 파생 형태를 batch 변환으로 계산 (읽는 thread가 없을 때 호출)
+    void convertPending();
+
+private:
+    // node별 변환 대기 상태
+    enum PendingConversion : unsigned char {
+        PendingNone,      // 두 형태 모두 유효
+        PendingCartesian, // spherical만 유효 (x/y/z 계산 필요)
+        PendingSpherical  // cartesian만 유효 (r/theta/phi 계산 필요)
+    };
+
+    std::size_t count;
+    AlignedVector<int> indices;
+    AlignedVector<float> x, y, z;
+    AlignedVector<float> r, theta, phi;
+    AlignedVector<unsigned char> pending;
+    std::size_t pendingCount;
+
+    // 패딩을 포함한 배열 크기를 n개 이상으로 확장
+    void growTo(std::size_t n);
+    // pos 위치에 node의 값을 기록 (파생 형태가 없으면 기준 형태만 기록하고 변환 대기로 표시)
+    void write(std::size_t pos, const NodeVector& node);
+    // pos 위치의 변환 대기 상태 변경
+    void setPending(std::size_t pos, PendingConversion state);
+};
+
+#endif // NODESTORE_H
@@ -13,66 +13,152 @@
 
 // 기본 생성자
 NodeVector::NodeVector()
-    : sphericalNode(), cartesianNode() {}
+    : sphericalNode(), cartesianNode(), authoritativeForm(NodeVectorForm::Spherical),
+      conversionMode(NodeConversionMode::Eager), derivedState(DerivedReady) {}
 
 // Spherical Node Vector를 사용한 생성자
-NodeVector::NodeVector(const SphericalNodeVector& snv)
-    : sphericalNode(snv) {
-    ConvertSphericalToCartesian();  // 생성 시 Cartesian 좌표로 변환
+NodeVector::NodeVector(const SphericalNodeVector& snv, NodeConversionMode mode)
+    : sphericalNode(snv), cartesianNode(snv.i_n), authoritativeForm(NodeVectorForm::Spherical),
+      conversionMode(mode), derivedState(DerivedStale) {
+    if (conversionMode == NodeConversionMode::Eager) {
+        ConvertSphericalToCartesian();  // 생성 시 Cartesian 좌표로 변환
+    }
 }
 
 // Cartesian Node Vector를 사용한 생성자
-NodeVector::NodeVector(const CartesianNodeVector& cnv)
-    : cartesianNode(cnv) {
-    ConvertCartesianToSpherical();  // 생성 시 Spherical 좌표로 변환
+NodeVector::NodeVector(const CartesianNodeVector& cnv, NodeConversionMode mode)
+    : sphericalNode(cnv.i_n), cartesianNode(cnv), authoritativeForm(NodeVectorForm::Cartesian),
+      conversionMode(mode), derivedState(DerivedStale) {
+    if (conversionMode == NodeConversionMode::Eager) {
+        ConvertCartesianToSpherical();  // 생성 시 Spherical 좌표로 변환
+    }
 }
 
-// Spherical Node Vector를 반환하는 함수
-SphericalNodeVector NodeVector::GetSphericalNodeVector() const {
-    return sphericalNode;
+// 두 형태를 모두 받는 생성자 (NodeStore 등에서 저장된 값을 복원할 때 사용)
+NodeVector::NodeVector(const SphericalNodeVector& snv, const CartesianNodeVector& cnv)
+    : sphericalNode(snv), cartesianNode(cnv), authoritativeForm(NodeVectorForm::Spherical),
+      conversionMode(NodeConversionMode::Eager), derivedState(DerivedReady) {}
+
+// 복사 생성자
+NodeVector::NodeVector(const NodeVector& other) noexcept
+    : sphericalNode(other.sphericalNode), cartesianNode(other.cartesianNode),
+      authoritativeForm(other.authoritativeForm), conversionMode(other.conversionMode),
+      derivedState(DerivedStale) {
+    *this = other;
 }
 
-// Cartesian Node Vector를 반환하는 함수
-CartesianNodeVector NodeVector::GetCartesianNodeVector() const {
-    return cartesianNode;
+// 대입 연산자
+NodeVector& NodeVector::operator=(const NodeVector& other) noexcept {
+    if (this == &other) return *this;
+    authoritativeForm = other.authoritativeForm;
+    conversionMode = other.conversionMode;
+
+    // 기준 형태는 항상 복사, 파생 형태는 캐시가 유효할 때만 복사
+    bool ready = other.derivedState.load(std::memory_order_acquire) == DerivedReady;
+    if (authoritativeForm == NodeVectorForm::Spherical) {
+        sphericalNode = other.sphericalNode;
+        if (ready) cartesianNode = other.cartesianNode;
+    } else {
+        cartesianNode = other.cartesianNode;
+        if (ready) sphericalNode = other.sphericalNode;
+    }
+    derivedState.store(ready ? DerivedReady : DerivedStale, std::memory_order_release);
+    return *this;
 }
 
-// Spherical 좌표를 Cartesian 좌표로 변환하는 함수
-void NodeVector::ConvertSphericalToCartesian() {
+// 기준 형태(Spherical)로부터 Cartesian 계산
+CartesianNodeVector NodeVector::ComputeCartesian() const {
     // Vector3에서 r, theta, phi 추출
     float r = sphericalNode.sphericalCoords.x;
     float theta = sphericalNode.sphericalCoords.y; // 경도 (radians)
     float phi = sphericalNode.sphericalCoords.z;   // 위도 (radians)
 
-    // SphericalVector 생성
-    SphericalVector sv(r, theta, phi);
-
     // CoordinateConverter를 사용하여 변환
-    CartesianVector cv = CoordinateConverter::sphericalToCartesian(sv);
-
-    // 변환된 CartesianVector를 Vector3로 매핑
-    cartesianNode.cartesianCoords = Vector3(cv.x, cv.y, cv.z);
+    CartesianVector cv = CoordinateConverter::sphericalToCartesian(SphericalVector(r, theta, phi));
 
     // 인덱스 동기화
-    cartesianNode.i_n = sphericalNode.i_n;
+    return CartesianNodeVector(sphericalNode.i_n, cv.x, cv.y, cv.z);
 }
 
-// Cartesian 좌표를 Spherical 좌표로 변환하는 함수
-void NodeVector::ConvertCartesianToSpherical() {
+// 기준 형태(Cartesian)로부터 Spherical 계산
+SphericalNodeVector NodeVector::ComputeSpherical() const {
     // Vector3에서 x, y, z 추출
     float x = cartesianNode.cartesianCoords.x;
     float y = cartesianNode.cartesianCoords.y;
     float z = cartesianNode.cartesianCoords.z;
 
-    // CartesianVector 생성
-    CartesianVector cv(x, y, z);
-
     // CoordinateConverter를 사용하여 변환
-    SphericalVector sv = CoordinateConverter::cartesianToSpherical(cv);
-
-    // 변환된 SphericalVector를 Vector3로 매핑
-    sphericalNode.sphericalCoords = Vector3(sv.r, sv.theta, sv.phi);
+    SphericalVector sv = CoordinateConverter::cartesianToSpherical(CartesianVector(x, y, z));
 
     // 인덱스 동기화
-    sphericalNode.i_n = cartesianNode.i_n;
+    return SphericalNodeVector(cartesianNode.i_n, sv.r, sv.theta, sv.phi);
+}
+
+// 파생 형태 캐시 채우기 (Stale -> Computing -> Ready)
+bool NodeVector::FillDerivedCache() const {
+    unsigned char expected = DerivedStale;
+    if (!derivedState.compare_exchange_strong(expected, DerivedComputing, std::memory_order_acq_rel)) {
+        return expected == DerivedReady;
+    }
+    if (authoritativeForm == NodeVectorForm::Spherical) {
+        cartesianNode = ComputeCartesian();
+    } else {
+        sphericalNode = ComputeSpherical();
+    }
+    derivedState.store(DerivedReady, std::memory_order_release);
+    return true;
+}
+
+// Spherical Node Vector를 반환하는 함수
+SphericalNodeVector NodeVector::GetSphericalNodeVector() const {
+    if (authoritativeForm == NodeVectorForm::Spherical || FillDerivedCache()) {
+        return sphericalNode;
+    }
+    // 다른 스레드가 캐시를 기록 중이면 지역 값으로 계산
+    return ComputeSpherical();
+}
+
+// Cartesian Node Vector를 반환하는 함수
+CartesianNodeVector NodeVector::GetCartesianNodeVector() const {
+    if (authoritativeForm == NodeVectorForm::Cartesian || FillDerivedCache()) {
+        return cartesianNode;
+    }
+    // 다른 스레드가 캐시를 기록 중이면 지역 값으로 계산
+    return ComputeCartesian();
+}
+
+// Spherical 값 수정 (Cartesian 무효화)
+void NodeVector::SetSphericalNodeVector(const SphericalNodeVector& snv) {
+    sphericalNode = snv;
+    authoritativeForm = NodeVectorForm::Spherical;
+    derivedState.store(DerivedStale, std::memory_order_release);
+    if (conversionMode == NodeConversionMode::Eager) {
+        ConvertSphericalToCartesian();
+    }
+}
+
+// Cartesian 값 수정 (Spherical 무효화)
+void NodeVector::SetCartesianNodeVector(const CartesianNodeVector& cnv) {
+    cartesianNode = cnv;
+    authoritativeForm = NodeVectorForm::Cartesian;
+    derivedState.store(DerivedStale, std::memory_order_release);
+    if (conversionMode == NodeConversionMode::Eager) {
+        ConvertCartesianToSpherical();
+    }
+}
+
+// Spherical 좌표를 Cartesian 좌표로 변환하는 함수
+void NodeVector::ConvertSphericalToCartesian() {
+    sphericalNode = GetSphericalNodeVector();
+    authoritativeForm = NodeVectorForm::Spherical;
+    cartesianNode = ComputeCartesian();
+    derivedState.store(DerivedReady, std::memory_order_release);
+}
+
+// Cartesian 좌표를 Spherical 좌표로 변환하는 함수
+void NodeVector::ConvertCartesianToSpherical() {
+    cartesianNode = GetCartesianNodeVector();
+    authoritativeForm = NodeVectorForm::Cartesian;
+    sphericalNode = ComputeSpherical();
+    derivedState.store(DerivedReady, std::memory_order_release);
 }
@@ -16,6 +16,7 @@
 
 #include "Vector3.h"
 #include "CoordinateConverter.h"
+#include <atomic>
 
 // SphericalNodeVector 구조체
 struct SphericalNodeVector {
@@ -41,32 +42,85 @@ struct CartesianNodeVector {
         : i_n(index), cartesianCoords(x, y, z) {}
 };
 
+// NodeVector 변환 방식
+// Eager: 생성/수정 시 즉시 다른 형태로 변환 (기존 동작)
+// Lazy:  기준(authoritative) 형태만 저장하고, 다른 형태는 처음 읽을 때 계산
+enum class NodeConversionMode : unsigned char {
+    Eager,
+    Lazy
+};
+
+// NodeVector의 기준 형태
+enum class NodeVectorForm : unsigned char {
+    Spherical,
+    Cartesian
+};
+
 // NodeVector 클래스 선언
+// 읽기(Get*) 함수는 여러 스레드에서 동시에 호출해도 안전하다.
+// 파생 형태를 계산 중인 다른 스레드가 있으면 캐시를 기다리지 않고 지역 값으로 계산해 반환한다.
+// 수정(Set*, Convert*)은 읽기와 동시에 호출하면 안 된다.
 class NodeVector {
 private:
-    SphericalNodeVector sphericalNode;   // Spherical 형태의 Node Vector
-    CartesianNodeVector cartesianNode;   // Cartesian 형태의 Node Vector
+    // 파생 형태 캐시 상태
+    enum DerivedState : unsigned char {
+        DerivedStale,     // 다시 계산 필요
+        DerivedComputing, // 한 스레드가 캐시에 기록 중
+        DerivedReady      // 캐시 유효
+    };
+
+    mutable SphericalNodeVector sphericalNode;   // Spherical 형태의 Node Vector
+    mutable CartesianNodeVector cartesianNode;   // Cartesian 형태의 Node Vector
+    NodeVectorForm authoritativeForm;            // 기준 형태
+    NodeConversionMode conversionMode;           // 변환 방식
+    mutable std::atomic<unsigned char> derivedState; // 파생 형태 캐시 상태
+
+    // 기준 형태로부터 파생 형태를 계산 (멤버에 기록하지 않음)
+    CartesianNodeVector ComputeCartesian() const;
+    SphericalNodeVector ComputeSpherical() const;
+
+    // 파생 형태 캐시를 채움. 다른 스레드가 기록 중이면 false 반환
+    bool FillDerivedCache() const;
 
 public:
     // 기본 생성자
     NodeVector();
 
     // Spherical Node Vector를 사용한 생성자
-    NodeVector(const SphericalNodeVector& snv);
+    NodeVector(const SphericalNodeVector& snv, NodeConversionMode mode = NodeConversionMode::Eager);
 
     // Cartesian Node Vector를 사용한 생성자
-    NodeVector(const CartesianNodeVector& cnv);
+    NodeVector(const CartesianNodeVector& cnv, NodeConversionMode mode = NodeConversionMode::Eager);
+
+    // 이미 변환된 두 형태를 그대로 사용하는 생성자 (변환 계산 없음)
+    NodeVector(const SphericalNodeVector& snv, const CartesianNodeVector& cnv);
 
-    // Spherical Node Vector를 반환하는 함수
+    // 복사/대입 (캐시가 유효할 때만 파생 형태를 함께 복사)
+    // noexcept: NodeVector를 담은 LinerSegment가 vector 재할당 시 복사가 아닌 move로 옮겨지도록 함
+    NodeVector(const NodeVector& other) noexcept;
+    NodeVector& operator=(const NodeVector& other) noexcept;
+
+    // Spherical Node Vector를 반환하는 함수 (Lazy 모드에서는 필요 시 계산)
     SphericalNodeVector GetSphericalNodeVector() const;
 
-    // Cartesian Node Vector를 반환하는 함수
+    // Cartesian Node Vector를 반환하는 함수 (Lazy 모드에서는 필요 시 계산)
     CartesianNodeVector GetCartesianNodeVector() const;
 
-    // Spherical 좌표를 Cartesian 좌표로 변환하는 함수
+    // 값을 수정하고 해당 형태를 기준 형태로 지정 (다른 형태는 무효화)
+    void SetSphericalNodeVector(const SphericalNodeVector& snv);
+    void SetCartesianNodeVector(const CartesianNodeVector& cnv);
+
+    // 기준 형태 및 변환 방식
+    NodeVectorForm GetAuthoritativeForm() const { return authoritativeForm; }
+    NodeConversionMode GetConversionMode() const { return conversionMode; }
+
+    // 파생 형태가 이미 계산되어 있는지 여부
+    bool HasDerivedForm() const { return derivedState.load(std::memory_order_acquire) == DerivedReady; }
+
+    // Spherical 좌표를 Cartesian 좌표로 변환하는 함수 (Spherical을 기준 형태로 지정)
     void ConvertSphericalToCartesian();
 
-    // Cartesian 좌표를 Spherical 좌표로 변환하는 함수
+    // Cartesian 좌표를 Spherical 좌표로 변환하는 함수 (Cartesian을 기준 형태로 지정)
     void ConvertCartesianToSpherical();
 };
 
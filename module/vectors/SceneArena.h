@@ -0,0 +1,89 @@
+/* SceneArena.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose of Class
+ * Scene 단위 memory arena와 이를 사용하는 allocator
+ *
+ * LinerSegment마다 control point, sample, bearing 방향 배열을 따로 heap에 할당하면
+ * segment 수가 많은 scene에서 작은 할당이 수백만 번 일어나고 heap이 조각난다.
+ * SceneArena는 크기별 pool(std::pmr::synchronized_pool_resource)에서 블록을 나눠 주고,
+ * scene 전체를 지울 때 release()로 한 번에 반환한다.
+ * 여러 thread에서 동시에 할당/해제해도 안전하다 (병렬 재샘플링).
+ */
+
+#ifndef SCENEARENA_H
+#define SCENEARENA_H
+
+#include "Vector3.h"
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief memory_resource에서 할당하는 allocator.
+ *        move/swap하면 allocator(arena)도 함께 옮겨 가지만, 복사본은 일반 heap을 사용한다.
+ *        arena는 manager가 release()하거나 소멸하면 사라지므로, manager 밖으로 복사된 segment
+ *        (GetLinerSegment 결과의 복사, ReadAllAttributes 등)가 arena를 가리키면 안 된다.
+ *        arena로 옮기는 것은 setAllocator (AttributesManager::AdoptSegment)뿐이다.
+ */
+template <typename T>
+struct ArenaAllocator {
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    std::pmr::memory_resource* resource;
+
+    // 기본값은 일반 heap (new/delete)
+    ArenaAllocator() noexcept : resource(std::pmr::new_delete_resource()) {}
+    explicit ArenaAllocator(std::pmr::memory_resource* source) noexcept : resource(source) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : resource(other.resource) {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(resource->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        resource->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    // container 복사본은 일반 heap (new/delete) 사용
+    ArenaAllocator select_on_container_copy_construction() const { return ArenaAllocator(); }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return resource == other.resource; }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept { return resource != other.resource; }
+};
+
+// segment의 점 배열 (control point, sample, bearing 방향)
+using ScenePointVector = std::vector<Vector3, ArenaAllocator<Vector3>>;
+
+/**
+ * @brief SceneArena 클래스.
+ *        release()는 이 arena에서 할당한 container가 모두 소멸된 뒤에만 호출해야 한다.
+ */
+class SceneArena {
+public:
+    SceneArena() = default;
+    SceneArena(const SceneArena&) = delete;
+    SceneArena& operator=(const SceneArena&) = delete;
+
+    template <typename T = Vector3>
+    ArenaAllocator<T> allocator() { return ArenaAllocator<T>(&pool); }
+
+    // 모든 블록을 upstream(heap)에 한 번에 반환
+    void release() { pool.release(); }
+
+private:
+    std::pmr::synchronized_pool_resource pool;
+};
+
+#endif // SCENEARENA_H
@@ -0,0 +1,137 @@
+/* BezierSamplerBenchmark.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose:
+ * Compare throughput and accuracy of the Bezier sampling engines
+ * (BernsteinTable, ForwardDifference, DeCasteljau, PiecewiseCubic) for degree 3 ~ 64.
+ * PiecewiseCubic is measured with its chain prebuilt (tolerance 0.01), like the shared basis.
+ *
+ * Usage: BezierSamplerBenchmark [levelOfDetail=50] [minMillisecondsPerCase=200]
+ * Error is the maximum distance to a long double de Casteljau reference.
+ */
+
+#include "BernsteinBasis.h"
+#include "BezierSampler.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+// long double de Casteljau 기준값
+void ReferenceSamples(const std::vector<Vector3>& cp, int sampleCount, std::vector<long double>& out) {
+    const int n = static_cast<int>(cp.size()) - 1;
+    std::vector<long double> wx(cp.size()), wy(cp.size()), wz(cp.size());
+    out.resize(3 * (static_cast<std::size_t>(sampleCount) + 1));
+    for (int s = 0; s <= sampleCount; ++s) {
+        long double t = static_cast<long double>(s) / sampleCount;
+        long double u = 1.0L - t;
+        for (int i = 0; i <= n; ++i) {
+            wx[i] = cp[i].x;
+            wy[i] = cp[i].y;
+            wz[i] = cp[i].z;
+        }
+        for (int k = 1; k <= n; ++k) {
+            for (int i = 0; i <= n - k; ++i) {
+                wx[i] = u * wx[i] + t * wx[i + 1];
+                wy[i] = u * wy[i] + t * wy[i + 1];
+                wz[i] = u * wz[i] + t * wz[i + 1];
+            }
+        }
+        out[3 * s] = wx[0];
+        out[3 * s + 1] = wy[0];
+        out[3 * s + 2] = wz[0];
+    }
+}
+
+double MaxError(const std::vector<Vector3>& sampled, const std::vector<long double>& reference) {
+    double maxError = 0.0;
+    for (std::size_t s = 0; s < sampled.size(); ++s) {
+        long double ex = sampled[s].x - reference[3 * s];
+        long double ey = sampled[s].y - reference[3 * s + 1];
+        long double ez = sampled[s].z - reference[3 * s + 2];
+        maxError = std::max(maxError, static_cast<double>(std::sqrt(ex * ex + ey * ey + ez * ez)));
+    }
+    return maxError;
+}
+
+// 최소 minMs 동안 반복 실행하고 초당 샘플 수 반환
+template <typename Fn>
+double Throughput(Fn&& sample, int samplesPerCall, double minMs) {
+    using Clock = std::chrono::steady_clock;
+    long long calls = 0;
+    auto start = Clock::now();
+    double elapsedMs = 0.0;
+    do {
+        for (int i = 0; i < 64; ++i) sample();
+        calls += 64;
+        elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    } while (elapsedMs < minMs);
+    return calls * static_cast<double>(samplesPerCall) / (elapsedMs / 1000.0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int sampleCount = argc > 1 ? std::atoi(argv[1]) : 50;
+    const double minMs = argc > 2 ? std::atof(argv[2]) : 200.0;
+    const int degrees[] = {3, 4, 6, 8, 12, 16, 24, 32, 48, 64};
+
+    std::mt19937 rng(2024);
+    std::uniform_real_distribution<float> coord(-10.0f, 10.0f);
+
+    std::printf("LevelOfDetail = %d (samples per curve = %d)\n", sampleCount, sampleCount + 1);
+    std::printf("%6s | %14s %10s | %14s %10s | %14s %10s | %14s %10s\n", "degree",
+                "Bernstein/s", "error", "ForwardDiff/s", "error", "DeCasteljau/s", "error", "Cubic/s", "error");
+
+    for (int degree : degrees) {
+        std::vector<Vector3> cp(static_cast<std::size_t>(degree) + 1);
+        for (auto& p : cp) p = Vector3(coord(rng), coord(rng), coord(rng));
+
+        std::vector<long double> reference;
+        ReferenceSamples(cp, sampleCount, reference);
+
+        std::vector<Vector3> sampled(static_cast<std::size_t>(sampleCount) + 1);
+        std::vector<double> differenceScratch;
+        std::vector<Vector3> casteljauScratch;
+        auto basis = BernsteinBasisCache::Get(degree, sampleCount);
+        BezierCubicChain chain;
+        BezierCubicScratch cubicScratch;
+        BezierSampler::BuildCubicChain(cp.data(), degree, 0.01f, chain, cubicScratch);
+
+        auto bernstein = [&]() { basis->Evaluate(cp.data(), sampled.data()); };
+        auto forward = [&]() {
+            BezierSampler::SampleForwardDifference(cp.data(), degree, sampleCount, sampled.data(), differenceScratch);
+        };
+        auto casteljau = [&]() {
+            BezierSampler::SampleDeCasteljau(cp.data(), degree, sampleCount, sampled.data(), casteljauScratch);
+        };
+        auto cubic = [&]() { BezierSampler::SampleCubicChain(chain, sampleCount, sampled.data()); };
+
+        bernstein();
+        double bernsteinError = MaxError(sampled, reference);
+        double bernsteinRate = Throughput(bernstein, sampleCount + 1, minMs);
+
+        forward();
+        double forwardError = MaxError(sampled, reference);
+        double forwardRate = Throughput(forward, sampleCount + 1, minMs);
+
+        casteljau();
+        double casteljauError = MaxError(sampled, reference);
+        double casteljauRate = Throughput(casteljau, sampleCount + 1, minMs);
+
+        cubic();
+        double cubicError = MaxError(sampled, reference);
+        double cubicRate = Throughput(cubic, sampleCount + 1, minMs);
+
+        std::printf("%6d | %14.3e %10.2e | %14.3e %10.2e | %14.3e %10.2e | %14.3e %10.2e\n", degree,
+                    bernsteinRate, bernsteinError, forwardRate, forwardError, casteljauRate, casteljauError,
+                    cubicRate, cubicError);
+    }
+    return 0;
+}
@@ -0,0 +1,201 @@
+/* LinerSegmentTest.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 16, 2026
+ *
+ * Purpose:
+ * LinerSegment::SamplingBezierCurve의 steady-state heap 할당 검사
+ * 전역 operator new를 교체해 할당 횟수를 세고, warm-up 이후 같은 bearing 개수/LOD로
+ * 다시 샘플링할 때 할당이 0번인지 evaluator, sampling mode, topology 연결 여부별로 확인한다.
+ * Profiler 기록 중에도 (thread track 생성 이후) 할당이 없어야 한다.
+ * scene arena에 있는 segment를 복사하면 복사본은 arena가 아닌 일반 heap을 사용해야 한다.
+ *
+ * Usage: LinerSegmentTest (실패 시 0이 아닌 값 반환)
+ */
+
+#include "LinerSegment.h"
+#include "Profiler.h"
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace {
+
+std::atomic<long> g_allocationCount{0};
+
+void* CountedAllocate(std::size_t size) {
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* CountedAllocateAligned(std::size_t size, std::size_t alignment) {
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    std::size_t rounded = (size + alignment - 1) / alignment * alignment;
+    void* p = std::aligned_alloc(alignment, rounded ? rounded : alignment);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+} // namespace
+
+// 전역 할당 함수 교체 (할당 횟수 측정)
+void* operator new(std::size_t size) { return CountedAllocate(size); }
+void* operator new[](std::size_t size) { return CountedAllocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return CountedAllocateAligned(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return CountedAllocateAligned(size, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace {
+
+const int kNodeCount = 2;
+const int kBearingsPerNode = 3;
+const int kRepeats = 100;
+
+// node 2개와 node별 bearing을 가진 최소 topology
+class TestTopology : public SegmentTopologySource {
+public:
+    TestTopology() {
+        for (int i = 1; i <= kNodeCount; ++i) {
+            nodes.emplace_back(SphericalNodeVector(i, 10.0f * i, static_cast<float>(M_PI / (i + 1)), static_cast<float>(M_PI / 4)));
+            std::vector<BearingVector> list;
+            for (int d = 1; d <= kBearingsPerNode; ++d) {
+                list.emplace_back(i, d, static_cast<float>(M_PI / (d + 2)), static_cast<float>(M_PI / (d + 1)),
+                                  1.0f * d, 2.0f, 0.5f * i);
+            }
+            bearings.push_back(list);
+        }
+    }
+
+    bool NodePosition(int nodeIndex, Vector3& position) const override {
+        if (nodeIndex < 1 || nodeIndex > kNodeCount) return false;
+        position = nodes[nodeIndex - 1].GetCartesianNodeVector().cartesianCoords;
+        return true;
+    }
+
+    void BearingDirections(int nodeIndex, ScenePointVector& directions) const override {
+        if (nodeIndex < 1 || nodeIndex > kNodeCount) return;
+        for (const auto& bearing : bearings[nodeIndex - 1]) {
+            directions.push_back(bearing.getWeightedDirection());
+        }
+    }
+
+    NodeVector Node(int nodeIndex) const override {
+        if (nodeIndex < 1 || nodeIndex > kNodeCount) return NodeVector();
+        return nodes[nodeIndex - 1];
+    }
+
+    NodeVectorWithBearing WithBearing(int nodeIndex) const {
+        NodeVectorWithBearing result;
+        result.node = nodes[nodeIndex - 1];
+        result.bearings = bearings[nodeIndex - 1];
+        return result;
+    }
+
+private:
+    std::vector<NodeVector> nodes;
+    std::vector<std::vector<BearingVector>> bearings;
+};
+
+// warm-up 후 kRepeats번 다시 샘플링하는 동안의 할당 횟수
+long SteadyStateAllocations(LinerSegment& segment) {
+    segment.SamplingBezierCurve();
+    segment.SamplingBezierCurve();
+    long before = g_allocationCount.load();
+    for (int i = 0; i < kRepeats; ++i) {
+        segment.markDirty();
+        segment.SamplingBezierCurve();
+    }
+    return g_allocationCount.load() - before;
+}
+
+struct Case {
+    const char* name;
+    BezierEvaluator evaluator;
+    SamplingMode mode;
+};
+
+} // namespace
+
+int main() {
+    const Case cases[] = {
+        {"BernsteinTable", BezierEvaluator::BernsteinTable, SamplingMode::Uniform},
+        {"ForwardDifference", BezierEvaluator::ForwardDifference, SamplingMode::Uniform},
+        {"DeCasteljau", BezierEvaluator::DeCasteljau, SamplingMode::Uniform},
+        {"PiecewiseCubic", BezierEvaluator::PiecewiseCubic, SamplingMode::Uniform},
+        {"Adaptive", BezierEvaluator::BernsteinTable, SamplingMode::Adaptive},
+    };
+
+    TestTopology topology;
+    NodeVectorWithBearing start = topology.WithBearing(1);
+    NodeVectorWithBearing end = topology.WithBearing(2);
+
+    int failures = 0;
+    for (const Case& c : cases) {
+        LinerSegment bound(1, 2, topology, 50);
+        LinerSegment copied(start, end, 50);
+        for (LinerSegment* segment : {&bound, &copied}) {
+            segment->setEvaluator(c.evaluator);
+            segment->setSamplingMode(c.mode);
+            long allocations = SteadyStateAllocations(*segment);
+            bool ok = allocations == 0 && !segment->getSampledPoints().empty();
+            std::printf("%-18s %-8s allocations per %d resamples: %ld %s\n", c.name,
+                        segment->isBound() ? "bound" : "copied", kRepeats, allocations, ok ? "OK" : "FAIL");
+            if (!ok) ++failures;
+        }
+    }
+
+    // LOD를 바꾸면 한 번은 할당할 수 있지만, 이후에는 다시 0이어야 함
+    LinerSegment segment(1, 2, topology, 50);
+    segment.setLevelOfDetail(80);
+    long allocations = SteadyStateAllocations(segment);
+    std::printf("%-18s %-8s allocations per %d resamples: %ld %s\n", "LOD change", "bound", kRepeats, allocations,
+                allocations == 0 ? "OK" : "FAIL");
+    if (allocations != 0) ++failures;
+
+    // probe 기록 중: track은 처음 기록할 때 한 번만 할당
+    Profiler::Start();
+    LinerSegment profiled(1, 2, topology, 50);
+    allocations = SteadyStateAllocations(profiled);
+    Profiler::Stop();
+    std::printf("%-18s %-8s allocations per %d resamples: %ld %s\n", "Profiler recording", "bound", kRepeats,
+                allocations, allocations == 0 ? "OK" : "FAIL");
+    if (allocations != 0) ++failures;
+
+    // arena segment의 복사본은 arena가 해제된 뒤에도 유효해야 함 (복사/대입 모두 일반 heap)
+    bool heapCopies;
+    {
+        SceneArena arena;
+        LinerSegment adopted(1, 2, topology, 50);
+        adopted.setAllocator(arena.allocator());
+        adopted.SamplingBezierCurve();
+        LinerSegment constructed(adopted);
+        LinerSegment assigned(start, end, 10);
+        assigned = adopted;
+        const ArenaAllocator<Vector3> heap;
+        heapCopies = adopted.getSampledPoints().get_allocator() == arena.allocator() &&
+                     constructed.getSampledPoints().get_allocator() == heap &&
+                     constructed.getControlPoints().get_allocator() == heap &&
+                     assigned.getSampledPoints().get_allocator() == heap &&
+                     constructed.getSampledPoints().size() == adopted.getSampledPoints().size();
+    }
+    std::printf("%-18s %-8s copies use heap allocator: %s\n", "Arena copy", "bound", heapCopies ? "OK" : "FAIL");
+    if (!heapCopies) ++failures;
+
+    return failures == 0 ? 0 : 1;
+}